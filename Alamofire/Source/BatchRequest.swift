@@ -0,0 +1,250 @@
+// BatchRequest.swift
+//
+// Copyright (c) 2014–2015 Alamofire Software Foundation (http://alamofire.org/)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+import Foundation
+
+extension Manager {
+
+    // MARK: - Batch Request
+
+    /**
+        Creates a batch of data requests for the specified URL requests.
+
+        The tasks of all the requests are created in a single pass on the queue of the manager, rather than one pass 
+        per request. Batched requests are independent calls made together, so they are neither served from the 
+        response cache nor coalesced with identical GET requests in flight.
+
+        If `startRequestsImmediately` is `true`, the requests will have `resume()` called before the batch is returned.
+
+        - parameter URLRequests: The URL requests.
+
+        - returns: The created batch request.
+    */
+    public func batchRequest(URLRequests: [URLRequestConvertible]) -> BatchRequest {
+        let mutableURLRequests = URLRequests.map { $0.URLRequest }
+        var dataTasks: [NSURLSessionDataTask] = []
+
+        dispatch_sync(queue) {
+            dataTasks = mutableURLRequests.map { self.session.dataTaskWithRequest($0) }
+        }
+
+        let requests = dataTasks.map { dataTask -> Request in
+            let request = Request(session: session, task: dataTask)
+            prepareRequest(request)
+            delegate[request.delegate.task] = request.delegate
+
+            return request
+        }
+
+        let batchRequest = BatchRequest(requests: requests)
+
+        if startRequestsImmediately {
+            batchRequest.resume()
+        }
+
+        return batchRequest
+    }
+}
+
+// MARK: -
+
+/**
+    A group of requests whose responses are delivered together, as one array of results in the order of the requests.
+
+    Each response handler added to the batch is called once, when every request has finished, and may also be given a 
+    closure called with the result of each request as it becomes available. The item closures and the handler of a 
+    batch run one at a time, in the order they are delivered, and the handler runs last, even on a concurrent queue.
+*/
+public final class BatchRequest {
+
+    // MARK: - Helper Types
+
+    /**
+        Used to specify the order in which the results of the requests are delivered to an item handler.
+
+        - `CompletionOrder`: Each result is delivered as soon as its request finishes.
+        - `RequestOrder`:    Results are delivered in the order of the requests, each one once every earlier 
+                             request has finished as well.
+    */
+    public enum Ordering {
+        case CompletionOrder
+        case RequestOrder
+    }
+
+    // MARK: - Properties
+
+    /// The requests of the batch, in the order of the URL requests they were created for.
+    public let requests: [Request]
+
+    // MARK: - Lifecycle
+
+    init(requests: [Request]) {
+        self.requests = requests
+    }
+
+    // MARK: - State
+
+    /**
+        Resumes the requests of the batch.
+    */
+    public func resume() {
+        for request in requests {
+            request.resume()
+        }
+    }
+
+    /**
+        Cancels the requests of the batch.
+    */
+    public func cancel() {
+        for request in requests {
+            request.cancel()
+        }
+    }
+
+    // MARK: - Response
+
+    /**
+        Adds a handler to be called once every request of the batch has finished.
+
+        - parameter queue:              The queue on which the handlers are dispatched, one at a time even if it is 
+                                        concurrent. The main queue if `nil`.
+        - parameter responseSerializer: The response serializer responsible for serializing each request, response, 
+                                        and data.
+        - parameter ordering:           The order in which results are delivered to the item handler. 
+                                        `.CompletionOrder` by default.
+        - parameter itemHandler:        The code to be executed with the index and result of each request. `nil` by 
+                                        default.
+        - parameter completionHandler:  The code to be executed with the results of all the requests, in the order of 
+                                        the requests.
+
+        - returns: The batch request.
+    */
+    public func response<T: ResponseSerializerType>(
+        queue queue: dispatch_queue_t? = nil,
+        responseSerializer: T,
+        ordering: Ordering = .CompletionOrder,
+        itemHandler: ((Int, Result<T.SerializedObject, T.ErrorObject>) -> Void)? = nil,
+        completionHandler: [Result<T.SerializedObject, T.ErrorObject>] -> Void)
+        -> Self
+    {
+        // Serial, so the item handlers cannot overtake each other or the completion handler on a concurrent queue
+        let completionQueue = dispatch_queue_create(nil, DISPATCH_QUEUE_SERIAL)
+        dispatch_set_target_queue(completionQueue, queue ?? dispatch_get_main_queue())
+
+        let aggregationQueue = dispatch_queue_create(nil, DISPATCH_QUEUE_SERIAL)
+        let group = dispatch_group_create()
+
+        // Only accessed on the aggregation queue until the group has been left by every request
+        var results = [Result<T.SerializedObject, T.ErrorObject>?](count: requests.count, repeatedValue: nil)
+        var nextIndexInOrder = 0
+
+        for (index, request) in requests.enumerate() {
+            dispatch_group_enter(group)
+
+            request.response(queue: aggregationQueue, responseSerializer: responseSerializer) { response in
+                results[index] = response.result
+
+                if let itemHandler = itemHandler {
+                    switch ordering {
+                    case .CompletionOrder:
+                        dispatch_async(completionQueue) { itemHandler(index, response.result) }
+                    case .RequestOrder:
+                        while nextIndexInOrder < results.count {
+                            guard let result = results[nextIndexInOrder] else { break }
+
+                            let resultIndex = nextIndexInOrder
+                            dispatch_async(completionQueue) { itemHandler(resultIndex, result) }
+                            nextIndexInOrder += 1
+                        }
+                    }
+                }
+
+                dispatch_group_leave(group)
+            }
+        }
+
+        dispatch_group_notify(group, completionQueue) {
+            completionHandler(results.flatMap { $0 })
+        }
+
+        return self
+    }
+
+    /**
+        Adds a handler to be called once every request of the batch has finished, with the data of each response.
+
+        - parameter queue:             The queue on which the handlers are dispatched. The main queue if `nil`.
+        - parameter ordering:          The order in which results are delivered to the item handler. 
+                                       `.CompletionOrder` by default.
+        - parameter itemHandler:       The code to be executed with the index and result of each request. `nil` by 
+                                       default.
+        - parameter completionHandler: The code to be executed with the results of all the requests.
+
+        - returns: The batch request.
+    */
+    public func responseData(
+        queue queue: dispatch_queue_t? = nil,
+        ordering: Ordering = .CompletionOrder,
+        itemHandler: ((Int, Result<NSData, NSError>) -> Void)? = nil,
+        completionHandler: [Result<NSData, NSError>] -> Void)
+        -> Self
+    {
+        return response(
+            queue: queue,
+            responseSerializer: Request.dataResponseSerializer(),
+            ordering: ordering,
+            itemHandler: itemHandler,
+            completionHandler: completionHandler
+        )
+    }
+
+    /**
+        Adds a handler to be called once every request of the batch has finished, with the JSON of each response.
+
+        - parameter queue:             The queue on which the handlers are dispatched. The main queue if `nil`.
+        - parameter options:           The JSON serialization reading options. `.AllowFragments` by default.
+        - parameter ordering:          The order in which results are delivered to the item handler. 
+                                       `.CompletionOrder` by default.
+        - parameter itemHandler:       The code to be executed with the index and result of each request. `nil` by 
+                                       default.
+        - parameter completionHandler: The code to be executed with the results of all the requests.
+
+        - returns: The batch request.
+    */
+    public func responseJSON(
+        queue queue: dispatch_queue_t? = nil,
+        options: NSJSONReadingOptions = .AllowFragments,
+        ordering: Ordering = .CompletionOrder,
+        itemHandler: ((Int, Result<AnyObject, NSError>) -> Void)? = nil,
+        completionHandler: [Result<AnyObject, NSError>] -> Void)
+        -> Self
+    {
+        return response(
+            queue: queue,
+            responseSerializer: Request.JSONResponseSerializer(options: options),
+            ordering: ordering,
+            itemHandler: itemHandler,
+            completionHandler: completionHandler
+        )
+    }
+}
@@ -0,0 +1,133 @@
+// BufferPool.swift
+//
+// Copyright (c) 2014–2015 Alamofire Software Foundation (http://alamofire.org/)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+import Foundation
+
+/**
+    A pool of page-aligned byte buffers of a fixed size, reused across stream reads so that copying any amount of data 
+    allocates at most one buffer per concurrent copy.
+
+    Buffers are taken from the pool for the duration of a copy and returned once it is done. Returned buffers beyond 
+    the maximum pooled count are freed rather than kept.
+*/
+public final class BufferPool {
+
+    // MARK: - Properties
+
+    /// A shared pool of 64 KB buffers, used by `MultipartFormData` by default.
+    public static let sharedPool = BufferPool()
+
+    /// The size in bytes of each buffer, rounded up to a whole number of memory pages.
+    public let bufferSize: Int
+
+    /// The maximum number of idle buffers kept for reuse.
+    public let maximumPooledBufferCount: Int
+
+    private let mutex = UnsafeMutablePointer<pthread_mutex_t>.alloc(1)
+    private var buffers: [UnsafeMutablePointer<UInt8>] = []
+    private let pageSize = Int(getpagesize())
+
+    // MARK: - Lifecycle
+
+    /**
+        Initializes the `BufferPool` instance with the specified buffer size and maximum number of pooled buffers.
+
+        - parameter bufferSize:               The size in bytes of each buffer. Rounded up to a whole number of memory 
+                                              pages. `65_536` by default.
+        - parameter maximumPooledBufferCount: The maximum number of idle buffers kept for reuse. `4` by default.
+
+        - returns: The new `BufferPool` instance.
+    */
+    public init(bufferSize: Int = 64 * 1024, maximumPooledBufferCount: Int = 4) {
+        let pageSize = Int(getpagesize())
+
+        self.bufferSize = max((bufferSize + pageSize - 1) / pageSize, 1) * pageSize
+        self.maximumPooledBufferCount = max(maximumPooledBufferCount, 0)
+
+        pthread_mutex_init(mutex, nil)
+    }
+
+    deinit {
+        for buffer in buffers {
+            free(buffer)
+        }
+
+        pthread_mutex_destroy(mutex)
+        mutex.dealloc(1)
+    }
+
+    // MARK: - Buffers
+
+    /**
+        Calls the closure with a buffer of `bufferSize` bytes taken from the pool, then returns the buffer to the pool.
+
+        The buffer must not be used once the closure has returned.
+
+        - parameter body: The closure using the buffer.
+
+        - throws: An `NSPOSIXErrorDomain` error if no buffer is pooled and a new one cannot be allocated, or the error 
+                  thrown by the closure.
+
+        - returns: The value returned by the closure.
+    */
+    func withBuffer<T>(@noescape body: UnsafeMutablePointer<UInt8> throws -> T) throws -> T {
+        let buffer = try takeBuffer()
+        defer { returnBuffer(buffer) }
+
+        return try body(buffer)
+    }
+
+    // MARK: - Private
+
+    private func takeBuffer() throws -> UnsafeMutablePointer<UInt8> {
+        pthread_mutex_lock(mutex)
+        let pooledBuffer = buffers.popLast()
+        pthread_mutex_unlock(mutex)
+
+        if let pooledBuffer = pooledBuffer {
+            return pooledBuffer
+        }
+
+        var memory: UnsafeMutablePointer<Void> = nil
+        let result = posix_memalign(&memory, pageSize, bufferSize)
+
+        guard result == 0 && memory != nil else {
+            let failureReason = "Failed to allocate a buffer of \(bufferSize) bytes"
+            let userInfo = [NSLocalizedFailureReasonErrorKey: failureReason]
+            throw NSError(domain: NSPOSIXErrorDomain, code: Int(result != 0 ? result : ENOMEM), userInfo: userInfo)
+        }
+
+        return UnsafeMutablePointer<UInt8>(memory)
+    }
+
+    private func returnBuffer(buffer: UnsafeMutablePointer<UInt8>) {
+        pthread_mutex_lock(mutex)
+
+        if buffers.count < maximumPooledBufferCount {
+            buffers.append(buffer)
+            pthread_mutex_unlock(mutex)
+        } else {
+            pthread_mutex_unlock(mutex)
+            free(buffer)
+        }
+    }
+}
@@ -0,0 +1,133 @@
+// ChunkedData.swift
+//
+// Copyright (c) 2014–2015 Alamofire Software Foundation (http://alamofire.org/)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+import Foundation
+
+/**
+    The data received for a request, kept as the list of chunks it arrived in.
+
+    Appending a chunk retains it without copying, so the storage never has to grow and move a single buffer while a 
+    large response is received, and peak memory stays close to the size of the payload. The bytes can be read in 
+    place with `enumerateBytes(_:)` or through the chunks themselves. A contiguous copy is only made when 
+    `contiguousData()` is called, after which it replaces the chunks.
+
+    A `ChunkedData` instance is not thread-safe. It is written on the session delegate queue while the request is 
+    running and should only be read once the request has completed, such as from a response handler.
+*/
+public final class ChunkedData {
+
+    /// The chunks in the order they were appended.
+    public private(set) var chunks: [NSData] = []
+
+    /// The total number of bytes in all chunks.
+    public private(set) var length = 0
+
+    /// Returns `true` if no bytes have been appended, `false` otherwise.
+    public var isEmpty: Bool { return length == 0 }
+
+    /**
+        Initializes an empty `ChunkedData` instance.
+
+        - returns: The new `ChunkedData` instance.
+    */
+    public init() {}
+
+    /**
+        Appends a chunk by reference. The chunk must not be mutated afterwards.
+
+        - parameter data: The chunk to append.
+    */
+    public func appendData(data: NSData) {
+        guard data.length > 0 else { return }
+
+        chunks.append(data)
+        length += data.length
+    }
+
+    /**
+        Calls the closure with the bytes of each chunk in order, without copying them.
+
+        The buffers are only valid for the duration of the call to the closure.
+
+        - parameter closure: The closure taking the bytes of a chunk and their offset in the data, and returning 
+                             `false` to stop the enumeration.
+    */
+    public func enumerateBytes(closure: (bytes: UnsafeBufferPointer<UInt8>, offset: Int) -> Bool) {
+        var offset = 0
+
+        for chunk in chunks {
+            var shouldContinue = true
+
+            chunk.enumerateByteRangesUsingBlock { bytes, range, stop in
+                let buffer = UnsafeBufferPointer(start: UnsafePointer<UInt8>(bytes), count: range.length)
+                shouldContinue = closure(bytes: buffer, offset: offset + range.location)
+
+                if !shouldContinue {
+                    stop.memory = true
+                }
+            }
+
+            guard shouldContinue else { return }
+
+            offset += chunk.length
+        }
+    }
+
+    /**
+        Returns the bytes of all chunks as a single `NSData` instance.
+
+        The data of a single chunk is returned as is. Otherwise the chunks are copied once into a buffer of the exact 
+        total length, which then replaces them so later calls return it without copying again. Each chunk is released 
+        as soon as it has been copied, so unless it is retained elsewhere, memory peaks at about the payload plus one 
+        chunk rather than twice the payload.
+
+        - returns: The contiguous data.
+    */
+    public func contiguousData() -> NSData {
+        if chunks.isEmpty {
+            return NSData()
+        } else if chunks.count == 1 {
+            return chunks[0]
+        }
+
+        let mutableData = NSMutableData(length: length)!
+        let destination = UnsafeMutablePointer<UInt8>(mutableData.mutableBytes)
+
+        // Popped from the end of a reversed copy, so that no chunk outlives the iteration copying it
+        var pendingChunks = Array(chunks.reverse())
+        var offset = 0
+
+        chunks = []
+
+        while let chunk = pendingChunks.popLast() {
+            chunk.enumerateByteRangesUsingBlock { bytes, range, _ in
+                memcpy(destination + offset + range.location, bytes, range.length)
+            }
+
+            offset += chunk.length
+        }
+
+        chunks = [mutableData]
+
+        return mutableData
+    }
+}
@@ -43,6 +43,7 @@ extension Manager {
         }
 
         let request = Request(session: session, task: downloadTask)
+        prepareRequest(request)
 
         if let downloadDelegate = request.delegate as? Request.DownloadTaskDelegate {
             downloadDelegate.downloadTaskDidFinishDownloadingToURL = { session, downloadTask, URL in
@@ -194,6 +195,8 @@ extension Request {
             downloadTask: NSURLSessionDownloadTask,
             didFinishDownloadingToURL location: NSURL)
         {
+            recordInitialResponse()
+
             if let downloadTaskDidFinishDownloadingToURL = downloadTaskDidFinishDownloadingToURL {
                 do {
                     let destination = downloadTaskDidFinishDownloadingToURL(session, downloadTask, location)
@@ -211,6 +214,8 @@ extension Request {
             totalBytesWritten: Int64,
             totalBytesExpectedToWrite: Int64)
         {
+            recordInitialResponse()
+
             if let downloadTaskDidWriteData = downloadTaskDidWriteData {
                 downloadTaskDidWriteData(
                     session,
@@ -220,8 +225,7 @@ extension Request {
                     totalBytesExpectedToWrite
                 )
             } else {
-                progress.totalUnitCount = totalBytesExpectedToWrite
-                progress.completedUnitCount = totalBytesWritten
+                updateProgressWithTotalBytes(totalBytesWritten, totalBytesExpected: totalBytesExpectedToWrite)
 
                 downloadProgress?(bytesWritten, totalBytesWritten, totalBytesExpectedToWrite)
             }
@@ -236,9 +240,555 @@ extension Request {
             if let downloadTaskDidResumeAtOffset = downloadTaskDidResumeAtOffset {
                 downloadTaskDidResumeAtOffset(session, downloadTask, fileOffset, expectedTotalBytes)
             } else {
-                progress.totalUnitCount = expectedTotalBytes
-                progress.completedUnitCount = fileOffset
+                updateProgressWithTotalBytes(fileOffset, totalBytesExpected: expectedTotalBytes)
+            }
+        }
+    }
+}
+
+// MARK: - Segmented Download
+
+extension Manager {
+
+    /**
+        Creates a segmented download for the specified method, URL string, headers and destination.
+
+        If `startRequestsImmediately` is `true`, the download will have `resume()` called before being returned.
+
+        - parameter method:            The HTTP method. `.GET` by default.
+        - parameter URLString:         The URL string.
+        - parameter headers:           The HTTP headers. `nil` by default.
+        - parameter segmentCount:      The number of segments downloaded in parallel. `4` by default.
+        - parameter maximumRetryCount: The number of times each segment is retried after a failure. `3` by default.
+        - parameter destination:       The closure used to determine the destination of the downloaded file.
+
+        - returns: The created segmented download.
+    */
+    public func segmentedDownload(
+        method: Method = .GET,
+        _ URLString: URLStringConvertible,
+        headers: [String: String]? = nil,
+        segmentCount: Int = 4,
+        maximumRetryCount: Int = 3,
+        destination: Request.DownloadFileDestination)
+        -> SegmentedDownload
+    {
+        return segmentedDownload(
+            URLRequest(method, URLString, headers: headers),
+            segmentCount: segmentCount,
+            maximumRetryCount: maximumRetryCount,
+            destination: destination
+        )
+    }
+
+    /**
+        Creates a segmented download for the specified URL request and destination.
+
+        If `startRequestsImmediately` is `true`, the download will have `resume()` called before being returned.
+
+        - parameter URLRequest:        The URL request.
+        - parameter segmentCount:      The number of segments downloaded in parallel. `4` by default.
+        - parameter maximumRetryCount: The number of times each segment is retried after a failure. `3` by default.
+        - parameter destination:       The closure used to determine the destination of the downloaded file.
+
+        - returns: The created segmented download.
+    */
+    public func segmentedDownload(
+        URLRequest: URLRequestConvertible,
+        segmentCount: Int = 4,
+        maximumRetryCount: Int = 3,
+        destination: Request.DownloadFileDestination)
+        -> SegmentedDownload
+    {
+        let download = SegmentedDownload(
+            manager: self,
+            request: URLRequest.URLRequest,
+            segmentCount: segmentCount,
+            maximumRetryCount: maximumRetryCount,
+            destination: destination
+        )
+
+        if startRequestsImmediately {
+            download.resume()
+        }
+
+        return download
+    }
+}
+
+// MARK: -
+
+/**
+    Downloads a file as several HTTP `Range` requests running in parallel.
+
+    A first request for the byte range `0-0` finds the length of the file. The destination file is then preallocated 
+    at a temporary location and split into segments, each downloaded by its own data task and written straight to its 
+    offset in the file. A segment that fails is retried from the last byte written, without affecting the others. Once 
+    every segment has completed, the file is moved to the destination.
+
+    Servers that do not answer the first request with `206 Partial Content` get a regular download instead. If the 
+    server provides a strong `ETag`, the segments are sent with `If-Range`, so that a file changing on the server fails 
+    the download rather than mixing two versions.
+*/
+public final class SegmentedDownload {
+
+    // MARK: - Helper Types
+
+    private struct Segment {
+        let startOffset: Int64
+        let endOffset: Int64
+        var bytesWritten: Int64 = 0
+        var retryCount = 0
+
+        init(startOffset: Int64, endOffset: Int64) {
+            self.startOffset = startOffset
+            self.endOffset = endOffset
+        }
+
+        var nextOffset: Int64 { return startOffset + bytesWritten }
+        var isComplete: Bool { return nextOffset > endOffset }
+    }
+
+    private enum State {
+        case Initialized, Probing, Downloading, Finished
+    }
+
+    // MARK: - Properties
+
+    /// The URL request the file is downloaded from.
+    public let request: NSURLRequest
+
+    /// The number of segments downloaded in parallel.
+    public let segmentCount: Int
+
+    /// The number of times each segment is retried after a failure.
+    public let maximumRetryCount: Int
+
+    /// The progress of the download, counting the bytes written to the file.
+    public let progress: NSProgress
+
+    /// The response to the first request of the download, if any.
+    public var response: NSHTTPURLResponse? {
+        var response: NSHTTPURLResponse?
+        dispatch_sync(queue) { response = self.firstResponse }
+        return response
+    }
+
+    private let manager: Manager
+    private let destination: Request.DownloadFileDestination
+    private let queue = dispatch_queue_create("com.alamofire.segmented-download", DISPATCH_QUEUE_SERIAL)
+
+    private var state: State = .Initialized
+    private var firstResponse: NSHTTPURLResponse?
+    private var entityTag: String?
+    private var segments: [Segment] = []
+    private var segmentRequests: [Int: Request] = [:]
+    private var fallbackRequest: Request?
+    private var temporaryURL: NSURL
+
+    // Written segments are copied to the file on the session delegate queue, so closing the file is serialized with
+    // every write by the mutex, and a write after the close finds no file to write to
+    private var fileDescriptor: Int32 = -1
+    private let fileMutex = UnsafeMutablePointer<pthread_mutex_t>.alloc(1)
+
+    private var destinationURL: NSURL?
+    private var error: NSError?
+    private var progressHandler: ((Int64, Int64, Int64) -> Void)?
+    private var completionHandlers: [(dispatch_queue_t, (NSURLRequest, NSHTTPURLResponse?, NSURL?, NSError?) -> Void)] = []
+
+    // MARK: - Lifecycle
+
+    init(
+        manager: Manager,
+        request: NSURLRequest,
+        segmentCount: Int,
+        maximumRetryCount: Int,
+        destination: Request.DownloadFileDestination)
+    {
+        self.manager = manager
+        self.request = request
+        self.segmentCount = max(segmentCount, 1)
+        self.maximumRetryCount = max(maximumRetryCount, 0)
+        self.destination = destination
+        self.progress = NSProgress(totalUnitCount: 0)
+
+        let fileName = "com.alamofire.segmented-download-\(NSUUID().UUIDString)"
+        self.temporaryURL = NSURL(fileURLWithPath: NSTemporaryDirectory()).URLByAppendingPathComponent(fileName)
+
+        pthread_mutex_init(fileMutex, nil)
+    }
+
+    deinit {
+        pthread_mutex_destroy(fileMutex)
+        fileMutex.dealloc(1)
+    }
+
+    // MARK: - Handlers
+
+    /**
+        Sets a closure to be called as segments are written to the file, with the bytes written, the total bytes 
+        written and the total bytes expected to write. The closure is called on an internal serial queue.
+
+        - parameter closure: The code to be executed as the file is written.
+
+        - returns: The segmented download.
+    */
+    public func progress(closure: ((Int64, Int64, Int64) -> Void)? = nil) -> Self {
+        dispatch_async(queue) { self.progressHandler = closure }
+        return self
+    }
+
+    /**
+        Adds a handler to be called once the download has finished, with the request, the response to the first 
+        request of the download, the destination of the file and the error, if any.
+
+        - parameter queue:             The queue on which the completion handler is dispatched. The main queue by 
+                                       default.
+        - parameter completionHandler: The code to be executed once the download has finished.
+
+        - returns: The segmented download.
+    */
+    public func response(
+        queue queue: dispatch_queue_t? = nil,
+        completionHandler: (NSURLRequest, NSHTTPURLResponse?, NSURL?, NSError?) -> Void)
+        -> Self
+    {
+        let completionQueue = queue ?? dispatch_get_main_queue()
+
+        dispatch_async(self.queue) {
+            if self.state == .Finished {
+                let (response, destinationURL, error) = (self.firstResponse, self.destinationURL, self.error)
+                dispatch_async(completionQueue) { completionHandler(self.request, response, destinationURL, error) }
+            } else {
+                self.completionHandlers.append((completionQueue, completionHandler))
+            }
+        }
+
+        return self
+    }
+
+    // MARK: - State
+
+    /**
+        Starts the download. Calling it again has no effect.
+    */
+    public func resume() {
+        dispatch_async(queue) {
+            guard self.state == .Initialized else { return }
+
+            self.state = .Probing
+            self.probe()
+        }
+    }
+
+    /**
+        Cancels the download and removes the partially written file.
+    */
+    public func cancel() {
+        dispatch_async(queue) {
+            guard self.state != .Finished else { return }
+
+            let error = NSError(domain: NSURLErrorDomain, code: NSURLErrorCancelled, userInfo: nil)
+            self.finishWithError(error)
+        }
+    }
+
+    // MARK: - Private - Probing
+
+    private func probe() {
+        let probeRequest = self.request.URLRequest
+        probeRequest.setValue("bytes=0-0", forHTTPHeaderField: "Range")
+
+        let request = manager.dataRequest(probeRequest)
+        let task = request.task
+        segmentRequests[-1] = request
+
+        // Only touched on the session delegate queue, then read by the response handler once the task completed
+        var ignoresRange = false
+
+        // A server ignoring the range sends the whole resource, which is cancelled at its first bytes
+        request.stream { _ in
+            guard let response = task.response as? NSHTTPURLResponse where !ignoresRange && response.statusCode != 206 else {
+                return
+            }
+
+            ignoresRange = true
+            task.cancel()
+        }
+
+        request.response(queue: queue) { _, response, _, error in
+            self.segmentRequests[-1] = nil
+
+            guard self.state == .Probing else { return }
+
+            if ignoresRange {
+                self.downloadWithoutSegments()
+            } else if let error = error {
+                self.finishWithError(error)
+            } else if let
+                response = response,
+                totalBytes = SegmentedDownload.totalBytesForResponse(response)
+                where response.statusCode == 206 && totalBytes > 0
+            {
+                self.firstResponse = response
+                self.downloadSegmentsWithTotalBytes(totalBytes)
+            } else {
+                self.downloadWithoutSegments()
+            }
+        }
+
+        request.resume()
+    }
+
+    private static func totalBytesForResponse(response: NSHTTPURLResponse) -> Int64? {
+        guard let contentRange = HTTPHeaders.valueForField("Content-Range", inHeaders: response.allHeaderFields),
+            totalBytes = contentRange.componentsSeparatedByString("/").last else
+        {
+            return nil
+        }
+
+        return Int64(totalBytes.stringByTrimmingCharactersInSet(.whitespaceCharacterSet()))
+    }
+
+    private static func startOffsetForResponse(response: NSHTTPURLResponse) -> Int64? {
+        // Content-Range: bytes <start>-<end>/<total>
+        guard let contentRange = HTTPHeaders.valueForField("Content-Range", inHeaders: response.allHeaderFields),
+            range = contentRange.componentsSeparatedByString(" ").last,
+            startOffset = range.componentsSeparatedByString("-").first else
+        {
+            return nil
+        }
+
+        return Int64(startOffset)
+    }
+
+    // MARK: - Private - Segments
+
+    private func downloadSegmentsWithTotalBytes(totalBytes: Int64) {
+        fileDescriptor = open(temporaryURL.path ?? "", O_CREAT | O_TRUNC | O_WRONLY, 0o644)
+
+        guard fileDescriptor >= 0 && ftruncate(fileDescriptor, off_t(totalBytes)) == 0 else {
+            let failureReason = "Destination file could not be preallocated: \(String.fromCString(strerror(errno)) ?? "")"
+            finishWithError(Error.errorWithCode(.OutputStreamWriteFailed, failureReason: failureReason))
+            return
+        }
+
+        if let
+            response = firstResponse,
+            entityTag = HTTPHeaders.valueForField("ETag", inHeaders: response.allHeaderFields)
+            where !entityTag.hasPrefix("W/")
+        {
+            self.entityTag = entityTag
+        }
+
+        let segmentCount = Int64(min(Int64(self.segmentCount), totalBytes))
+        let segmentLength = (totalBytes + segmentCount - 1) / segmentCount
+
+        segments = (0..<segmentCount).map { index in
+            let startOffset = index * segmentLength
+            return Segment(startOffset: startOffset, endOffset: min(startOffset + segmentLength, totalBytes) - 1)
+        }
+
+        progress.totalUnitCount = totalBytes
+        state = .Downloading
+
+        for index in segments.indices {
+            downloadSegment(index)
+        }
+    }
+
+    private func downloadSegment(index: Int) {
+        let segment = segments[index]
+        let expectedStartOffset = segment.nextOffset
+        let endOffset = segment.endOffset
+
+        let segmentRequest = self.request.URLRequest
+        segmentRequest.setValue("bytes=\(expectedStartOffset)-\(endOffset)", forHTTPHeaderField: "Range")
+
+        if let entityTag = entityTag {
+            segmentRequest.setValue(entityTag, forHTTPHeaderField: "If-Range")
+        }
+
+        // Created without being resumed, so that no data arrives before the stream closure is set
+        let request = manager.dataRequest(segmentRequest)
+        let task = request.task
+        segmentRequests[index] = request
+
+        // Only touched on the session delegate queue, then read by the response handler once the task completed
+        var offset = expectedStartOffset
+        var writeError: NSError?
+
+        request.stream { data in
+            guard writeError == nil else { return }
+
+            guard let
+                response = task.response as? NSHTTPURLResponse
+                where response.statusCode == 206 &&
+                    SegmentedDownload.startOffsetForResponse(response) == expectedStartOffset else
+            {
+                task.cancel()
+                return
+            }
+
+            let length = Int(min(Int64(data.length), endOffset + 1 - offset))
+            guard length > 0 else { return }
+
+            guard let written = self.writeBytes(data.bytes, length: length, atOffset: offset) else {
+                // The download has finished and closed the file
+                return
+            }
+
+            if !written {
+                let failureReason = "Segment could not be written: \(String.fromCString(strerror(errno)) ?? "")"
+                writeError = Error.errorWithCode(.OutputStreamWriteFailed, failureReason: failureReason)
+                task.cancel()
+                return
+            }
+
+            offset += Int64(length)
+
+            dispatch_async(self.queue) {
+                guard self.state == .Downloading else { return }
+
+                self.segments[index].bytesWritten += Int64(length)
+                self.progress.completedUnitCount += Int64(length)
+                self.progressHandler?(Int64(length), self.progress.completedUnitCount, self.progress.totalUnitCount)
+            }
+        }
+
+        request.response(queue: queue) { _, response, _, error in
+            self.segmentRequests[index] = nil
+
+            guard self.state == .Downloading else { return }
+
+            if let writeError = writeError {
+                self.finishWithError(writeError)
+            } else if self.segments[index].isComplete {
+                if self.segments.indexOf({ !$0.isComplete }) == nil {
+                    self.finishWithError(nil)
+                }
+            } else if response?.statusCode == 200 {
+                // The server ignored the range, or the file changed and If-Range asked for all of it
+                let failureReason = "Server did not return the requested range of the file"
+                self.finishWithError(Error.errorWithCode(.RangeRequestFailed, failureReason: failureReason))
+            } else if self.segments[index].retryCount < self.maximumRetryCount {
+                self.segments[index].retryCount += 1
+
+                let delay = 0.5 * pow(2.0, Double(self.segments[index].retryCount - 1))
+                dispatch_after(dispatch_time(DISPATCH_TIME_NOW, Int64(delay * Double(NSEC_PER_SEC))), self.queue) {
+                    guard self.state == .Downloading else { return }
+                    self.downloadSegment(index)
+                }
+            } else {
+                let failureReason = "Segment \(index) failed after \(self.maximumRetryCount) retries"
+                self.finishWithError(error ?? Error.errorWithCode(.RangeRequestFailed, failureReason: failureReason))
+            }
+        }
+
+        request.resume()
+    }
+
+    // MARK: - Private - Fallback
+
+    private func downloadWithoutSegments() {
+        state = .Downloading
+
+        var destinationURL: NSURL?
+
+        let request = manager.download(self.request) { temporaryURL, response in
+            let URL = self.destination(temporaryURL, response)
+            destinationURL = URL
+
+            return URL
+        }
+
+        fallbackRequest = request
+
+        request.progress { bytesWritten, totalBytesWritten, totalBytesExpectedToWrite in
+            dispatch_async(self.queue) {
+                self.progress.totalUnitCount = totalBytesExpectedToWrite
+                self.progress.completedUnitCount = totalBytesWritten
+                self.progressHandler?(bytesWritten, totalBytesWritten, totalBytesExpectedToWrite)
+            }
+        }
+
+        request.response(queue: queue) { _, response, _, error in
+            self.fallbackRequest = nil
+
+            guard self.state == .Downloading else { return }
+
+            self.firstResponse = response
+            self.destinationURL = error == nil ? destinationURL : nil
+            self.finish(error)
+        }
+
+        request.resume()
+    }
+
+    // MARK: - Private - Completion
+
+    private func writeBytes(bytes: UnsafePointer<Void>, length: Int, atOffset offset: Int64) -> Bool? {
+        pthread_mutex_lock(fileMutex)
+        defer { pthread_mutex_unlock(fileMutex) }
+
+        guard fileDescriptor >= 0 else { return nil }
+
+        return pwrite(fileDescriptor, bytes, length, off_t(offset)) == length
+    }
+
+    private func finishWithError(error: NSError?) {
+        var finalError = error
+
+        // The other segments are stopped before the file is closed, so none of them writes to a reused descriptor
+        cancelRequests()
+
+        pthread_mutex_lock(fileMutex)
+
+        if fileDescriptor >= 0 {
+            close(fileDescriptor)
+            fileDescriptor = -1
+        }
+
+        pthread_mutex_unlock(fileMutex)
+
+        if let response = firstResponse where finalError == nil {
+            let destinationURL = destination(temporaryURL, response)
+
+            do {
+                try NSFileManager.defaultManager().moveItemAtURL(temporaryURL, toURL: destinationURL)
+                self.destinationURL = destinationURL
+            } catch {
+                finalError = error as NSError
             }
         }
+
+        _ = try? NSFileManager.defaultManager().removeItemAtURL(temporaryURL)
+
+        finish(finalError)
+    }
+
+    private func finish(error: NSError?) {
+        state = .Finished
+        self.error = error
+
+        cancelRequests()
+
+        let (response, destinationURL) = (firstResponse, self.destinationURL)
+
+        for (queue, completionHandler) in completionHandlers {
+            dispatch_async(queue) { completionHandler(self.request, response, destinationURL, error) }
+        }
+
+        completionHandlers.removeAll()
+    }
+
+    private func cancelRequests() {
+        for request in segmentRequests.values {
+            request.cancel()
+        }
+
+        segmentRequests.removeAll()
+        fallbackRequest?.cancel()
+        fallbackRequest = nil
     }
 }
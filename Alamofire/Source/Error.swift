@@ -37,6 +37,7 @@ public struct Error {
         case StringSerializationFailed       = -6005
         case JSONSerializationFailed         = -6006
         case PropertyListSerializationFailed = -6007
+        case RangeRequestFailed              = -6008
     }
 
     /**
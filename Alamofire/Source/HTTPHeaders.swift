@@ -0,0 +1,57 @@
+// HTTPHeaders.swift
+//
+// Copyright (c) 2014–2015 Alamofire Software Foundation (http://alamofire.org/)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+import Foundation
+
+/// Reads HTTP header fields and dates for the response cache, the retry policy and segmented downloads.
+struct HTTPHeaders {
+
+    /**
+        Returns the value of a header field, matching its name case-insensitively as HTTP requires.
+
+        - parameter field:   The header field name.
+        - parameter headers: The headers, such as `NSHTTPURLResponse.allHeaderFields`.
+
+        - returns: The value, or `nil` if the headers do not have the field.
+    */
+    static func valueForField(field: String, inHeaders headers: [NSObject: AnyObject]) -> String? {
+        let lowercaseField = field.lowercaseString
+
+        for (key, value) in headers {
+            if let key = key as? String where key.lowercaseString == lowercaseField {
+                return value as? String
+            }
+        }
+
+        return nil
+    }
+
+    /// Parses HTTP dates, such as those of the `Date`, `Expires`, `Last-Modified` and `Retry-After` headers.
+    static let dateFormatter: NSDateFormatter = {
+        let formatter = NSDateFormatter()
+        formatter.locale = NSLocale(localeIdentifier: "en_US_POSIX")
+        formatter.timeZone = NSTimeZone(abbreviation: "GMT")
+        formatter.dateFormat = "EEE, dd MMM yyyy HH:mm:ss zzz"
+
+        return formatter
+    }()
+}
@@ -0,0 +1,230 @@
+// HandlerQueue.swift
+//
+// Copyright (c) 2014–2015 Alamofire Software Foundation (http://alamofire.org/)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+import Foundation
+
+/**
+    Holds the closures added to a request until it completes, then runs them one at a time in the order they were 
+    added.
+
+    It stands in for a suspended serial `NSOperationQueue` without the cost of creating one for every request: the 
+    closures are kept in a list, and resuming the queue drains the list with a single closure submitted to a shared 
+    global queue. Closures added while the queue is resumed run after the ones already added, and suspending the queue 
+    again stops the drain before the next closure.
+
+    Request extensions may still ask for an `NSOperationQueue`. The first time `operationQueue` is accessed, the 
+    closures that have not run are moved to a new serial operation queue, and every closure added afterwards is 
+    forwarded to it, so the order of all closures is kept.
+*/
+final class HandlerQueue {
+
+    // MARK: - Properties
+
+    /// Whether closures are held rather than run. `true` until the request completes.
+    var suspended: Bool {
+        get {
+            pthread_mutex_lock(mutex)
+            defer { pthread_mutex_unlock(mutex) }
+
+            return isSuspended
+        }
+        set {
+            pthread_mutex_lock(mutex)
+            isSuspended = newValue
+
+            // A running drain passes the state on to the operation queue when it stops
+            let forwardingQueue = isDraining ? nil : forwardingOperationQueue
+            let shouldDrain = startDrainingIfNeeded()
+            pthread_mutex_unlock(mutex)
+
+            forwardingQueue?.suspended = newValue
+
+            if shouldDrain {
+                drain()
+            }
+        }
+    }
+
+    /**
+        The serial operation queue the closures run on once it has been accessed.
+
+        Creating it is only worth it for callers that need an `NSOperationQueue`. Once it exists, closures added 
+        through the `HandlerQueue` are added to it as operations.
+    */
+    var operationQueue: NSOperationQueue {
+        pthread_mutex_lock(mutex)
+
+        if let forwardingQueue = forwardingOperationQueue {
+            pthread_mutex_unlock(mutex)
+            return forwardingQueue
+        }
+
+        let forwardingQueue = NSOperationQueue()
+        forwardingQueue.maxConcurrentOperationCount = 1
+        forwardingQueue.suspended = true
+
+        if #available(OSX 10.10, *) {
+            forwardingQueue.qualityOfService = NSQualityOfService.Utility
+        }
+
+        for handler in handlers[headIndex..<handlers.count] {
+            forwardingQueue.addOperationWithBlock(handler)
+        }
+
+        handlers.removeAll()
+        headIndex = 0
+        forwardingOperationQueue = forwardingQueue
+
+        // A running drain resumes the operation queue once its current closure returns
+        let shouldResume = !isSuspended && !isDraining
+        pthread_mutex_unlock(mutex)
+
+        if shouldResume {
+            forwardingQueue.suspended = false
+        }
+
+        return forwardingQueue
+    }
+
+    private let mutex = UnsafeMutablePointer<pthread_mutex_t>.alloc(1)
+    private var handlers: [() -> Void] = []
+    private var headIndex = 0
+    private var isSuspended: Bool
+    private var isDraining = false
+    private var forwardingOperationQueue: NSOperationQueue?
+
+    private static let executionQueue: dispatch_queue_t = {
+        if #available(OSX 10.10, *) {
+            return dispatch_get_global_queue(Int(QOS_CLASS_UTILITY.rawValue), 0)
+        } else {
+            return dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_LOW, 0)
+        }
+    }()
+
+    // MARK: - Lifecycle
+
+    /**
+        Initializes the `HandlerQueue` instance, suspended by default.
+
+        - parameter suspended: Whether closures are held rather than run. `true` by default.
+
+        - returns: The new `HandlerQueue` instance.
+    */
+    init(suspended: Bool = true) {
+        self.isSuspended = suspended
+        pthread_mutex_init(mutex, nil)
+    }
+
+    deinit {
+        if let forwardingQueue = forwardingOperationQueue {
+            forwardingQueue.cancelAllOperations()
+            forwardingQueue.suspended = false
+        }
+
+        pthread_mutex_destroy(mutex)
+        mutex.dealloc(1)
+    }
+
+    // MARK: - Handlers
+
+    /**
+        Adds a closure to run after the closures already added, once the queue is not suspended.
+
+        - parameter block: The closure to run.
+    */
+    func addOperationWithBlock(block: () -> Void) {
+        pthread_mutex_lock(mutex)
+
+        if let forwardingQueue = forwardingOperationQueue {
+            pthread_mutex_unlock(mutex)
+            forwardingQueue.addOperationWithBlock(block)
+
+            return
+        }
+
+        handlers.append(block)
+        let shouldDrain = startDrainingIfNeeded()
+        pthread_mutex_unlock(mutex)
+
+        if shouldDrain {
+            drain()
+        }
+    }
+
+    /// Discards the closures that have not started running.
+    func cancelAllOperations() {
+        pthread_mutex_lock(mutex)
+        handlers.removeAll()
+        headIndex = 0
+        let forwardingQueue = forwardingOperationQueue
+        pthread_mutex_unlock(mutex)
+
+        forwardingQueue?.cancelAllOperations()
+    }
+
+    // MARK: - Private
+
+    // Must be called with the lock held
+    private func startDrainingIfNeeded() -> Bool {
+        guard !isSuspended && !isDraining && headIndex < handlers.count && forwardingOperationQueue == nil else {
+            return false
+        }
+
+        isDraining = true
+
+        return true
+    }
+
+    private func drain() {
+        dispatch_async(HandlerQueue.executionQueue) {
+            while true {
+                pthread_mutex_lock(self.mutex)
+
+                if let forwardingQueue = self.forwardingOperationQueue {
+                    self.isDraining = false
+                    let suspended = self.isSuspended
+                    pthread_mutex_unlock(self.mutex)
+
+                    forwardingQueue.suspended = suspended
+
+                    return
+                }
+
+                guard !self.isSuspended && self.headIndex < self.handlers.count else {
+                    // Keeps the closures held back by a suspension
+                    self.handlers.removeRange(0..<self.headIndex)
+                    self.headIndex = 0
+                    self.isDraining = false
+                    pthread_mutex_unlock(self.mutex)
+
+                    return
+                }
+
+                let handler = self.handlers[self.headIndex]
+                self.headIndex += 1
+                pthread_mutex_unlock(self.mutex)
+
+                handler()
+            }
+        }
+    }
+}
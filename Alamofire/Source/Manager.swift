@@ -98,6 +98,67 @@ public class Manager {
     /// Whether to start requests immediately after being constructed. `true` by default.
     public var startRequestsImmediately: Bool = true
 
+    /**
+        Whether a `GET` request identical to one already in flight shares its task instead of starting another. 
+        `false` by default.
+
+        Requests are identical when they have the same URL and HTTP headers. A coalesced request returns the `Request` 
+        already in flight, so every response handler added to it receives the single response. Because the `Request` 
+        is shared, cancelling it, validating it or setting its progress or stream closures affects every caller. A 
+        request waiting to be retried is still in flight.
+    */
+    public var coalescesIdenticalGETRequests: Bool = false
+
+    private var inFlightGETRequests: [String: Request] = [:]
+
+    /**
+        The cache `GET` responses are stored in and served from. `nil` by default, which leaves caching to the 
+        `NSURLCache` of the session configuration.
+
+        Fresh cached responses complete requests without reaching the network. Requests with the 
+        `ReloadIgnoringLocalCacheData` cache policy bypass the cache, but their responses are still stored.
+    */
+    public var responseCache: ResponseCache?
+
+    /// How stale responses in the `responseCache` are handled. `.Revalidate` by default.
+    public var responseCacheMode: ResponseCache.Mode = .Revalidate
+
+    private var revalidatingURLStrings: Set<String> = []
+
+    /**
+        The closure the timeline of the requests created by the manager is reported to, such as to export latency 
+        metrics. `nil` by default.
+
+        The closure is called once for every response handler of a request, on the queue of the handler and after it 
+        returns, so the timeline covers serialization and dispatch to that queue.
+    */
+    public var metricsSink: ((Request, Timeline) -> Void)?
+
+    /**
+        The executor running the response serializers of the requests created by the manager, such as 
+        `SerializationExecutor.sharedExecutor`. `nil` by default, which serializes responses on the serial operation 
+        queue of each request.
+
+        Changing the executor only applies to requests created afterwards.
+    */
+    public var serializationExecutor: SerializationExecutor?
+
+    /**
+        The policy deciding whether failed data requests of the manager are retried. `nil` by default.
+
+        A retried request keeps its `Request` instance: a new task replaces the failed one, and the response handlers 
+        only run once the last attempt completes. Uploads and streamed requests are never retried.
+    */
+    public var retryPolicy: RetryPolicy?
+
+    /**
+        The scheduler limiting how many requests of the manager run at once and in which order queued requests start. 
+        `nil` by default, which starts requests as soon as they are resumed.
+
+        Changing the scheduler only applies to requests created afterwards.
+    */
+    public var requestScheduler: RequestScheduler?
+
     /**
         The background completion handler closure provided by the UIApplicationDelegate 
         `application:handleEventsForBackgroundURLSession:completionHandler:` method. By setting the background 
@@ -208,14 +269,179 @@ public class Manager {
         - returns: The created request.
     */
     public func request(URLRequest: URLRequestConvertible) -> Request {
+        let mutableURLRequest = URLRequest.URLRequest
+
+        // Only the in-memory index is consulted here, the body of a cached response is read on the cache queue
+        if let cachedResponse = cachedResponseHeadForRequest(mutableURLRequest) {
+            if cachedResponse.isFresh {
+                return cachedRequest(mutableURLRequest)
+            } else if responseCacheMode == .StaleWhileRevalidate {
+                revalidateCachedResponse(cachedResponse, forRequest: mutableURLRequest)
+                return cachedRequest(mutableURLRequest)
+            }
+
+            responseCache?.addValidatorsToRequest(mutableURLRequest, cachedResponse: cachedResponse)
+            mutableURLRequest.cachePolicy = .ReloadIgnoringLocalCacheData
+        }
+
+        if coalescesIdenticalGETRequests {
+            if let key = coalescingKeyForRequest(mutableURLRequest) {
+                return coalescedRequest(mutableURLRequest, key: key)
+            }
+        }
+
+        let request = dataRequest(mutableURLRequest)
+        cacheResponseOfRequest(request)
+
+        if startRequestsImmediately {
+            request.resume()
+        }
+
+        return request
+    }
+
+    /// Creates and registers a data request without resuming it, bypassing the response cache and coalescing.
+    func dataRequest(URLRequest: NSURLRequest) -> Request {
         var dataTask: NSURLSessionDataTask!
 
         dispatch_sync(queue) {
-            dataTask = self.session.dataTaskWithRequest(URLRequest.URLRequest)
+            dataTask = self.session.dataTaskWithRequest(URLRequest)
         }
 
         let request = Request(session: session, task: dataTask)
+        prepareRequest(request)
+        delegate[request.delegate.task] = request.delegate
+
+        return request
+    }
+
+    /**
+        Connects a request created by the manager to the metrics sink, serialization executor and retry policy of the 
+        manager.
+
+        - parameter request: The request.
+    */
+    func prepareRequest(request: Request) {
+        request.metricsSink = { [weak self] request, timeline in
+            self?.metricsSink?(request, timeline)
+        }
+
+        request.serializationExecutor = serializationExecutor
+
+        request.delegate.retryHandler = { [weak self, weak request] error in
+            guard let strongSelf = self, request = request else { return false }
+            return strongSelf.retryRequest(request, error: error)
+        }
+
+        if let requestScheduler = requestScheduler {
+            request.scheduler = requestScheduler
+            request.delegate.requestDidFinish = { [unowned delegate = request.delegate] in
+                requestScheduler.didFinish(delegate)
+            }
+        }
+    }
+
+    // MARK: - Retrying
+
+    private func retryRequest(request: Request, error: NSError?) -> Bool {
+        guard let
+            retryPolicy = retryPolicy,
+            URLRequest = request.task.originalRequest
+            where request.delegate.canRetry && !request.delegate.isCancelled else
+        {
+            return false
+        }
+
+        guard let delay = retryPolicy.retryDelayForRequest(
+            URLRequest,
+            response: request.task.response as? NSHTTPURLResponse,
+            error: error,
+            retryCount: request.retryCount) else
+        {
+            return false
+        }
+
+        request.delegate.retryCount += 1
+
+        // Set before the task is reported complete, so the request is not taken for a finished one while it waits
+        dispatch_sync(queue) { request.delegate.isWaitingToRetry = true }
+
+        dispatch_after(dispatch_time(DISPATCH_TIME_NOW, Int64(delay * Double(NSEC_PER_SEC))), queue) {
+            request.delegate.isWaitingToRetry = false
+
+            guard !request.delegate.isCancelled else {
+                request.delegate.error = NSError(domain: NSURLErrorDomain, code: NSURLErrorCancelled, userInfo: nil)
+                request.delegate.requestDidFinish?()
+                request.delegate.progressReporter?.finish()
+                request.delegate.handlerQueue.suspended = false
+                return
+            }
+
+            // Already on the manager queue, which task creation is serialized on
+            let dataTask = self.session.dataTaskWithRequest(URLRequest)
+            request.delegate.prepareForRetryWithTask(dataTask)
+            self.delegate[dataTask] = request.delegate
+
+            dataTask.resume()
+        }
+
+        return true
+    }
+
+    // MARK: - Request Coalescing
+
+    private func coalescingKeyForRequest(URLRequest: NSURLRequest) -> String? {
+        guard let
+            method = URLRequest.HTTPMethod,
+            URLString = URLRequest.URL?.absoluteString
+            where method == Method.GET.rawValue else
+        {
+            return nil
+        }
+
+        let headers = (URLRequest.allHTTPHeaderFields ?? [:]).sort { $0.0 < $1.0 }
+        let headerLines = headers.map { "\($0): \($1)" }
+
+        return ([URLString] + headerLines).joinWithSeparator("\n")
+    }
+
+    private func coalescedRequest(URLRequest: NSURLRequest, key: String) -> Request {
+        var request: Request!
+        var isInFlight = false
+
+        dispatch_sync(queue) {
+            // A request waiting to be retried has a completed task, but its response is still to come
+            if let
+                inFlightRequest = self.inFlightGETRequests[key]
+                where inFlightRequest.delegate.isWaitingToRetry ||
+                    inFlightRequest.task.state == .Running ||
+                    inFlightRequest.task.state == .Suspended
+            {
+                request = inFlightRequest
+                isInFlight = true
+            } else {
+                let dataTask = self.session.dataTaskWithRequest(URLRequest)
+                request = Request(session: self.session, task: dataTask)
+                self.prepareRequest(request)
+                self.inFlightGETRequests[key] = request
+            }
+        }
+
+        guard !isInFlight else { return request }
+
         delegate[request.delegate.task] = request.delegate
+        cacheResponseOfRequest(request)
+
+        // The first operation on the delegate queue runs as soon as the task completes, before any response handler
+        request.delegate.handlerQueue.addOperationWithBlock { [weak self] in
+            guard let strongSelf = self else { return }
+
+            dispatch_async(strongSelf.queue) {
+                if strongSelf.inFlightGETRequests[key] === request {
+                    strongSelf.inFlightGETRequests.removeValueForKey(key)
+                }
+            }
+        }
 
         if startRequestsImmediately {
             request.resume()
@@ -224,29 +450,134 @@ public class Manager {
         return request
     }
 
+    // MARK: - Response Caching
+
+    private var sessionSendsAuthorization: Bool {
+        guard let headers = session.configuration.HTTPAdditionalHeaders else { return false }
+        return HTTPHeaders.valueForField("Authorization", inHeaders: headers) != nil
+    }
+
+    private func cachedResponseHeadForRequest(URLRequest: NSURLRequest) -> CachedResponse? {
+        guard let responseCache = responseCache where !sessionSendsAuthorization else { return nil }
+
+        switch URLRequest.cachePolicy {
+        case .ReloadIgnoringLocalCacheData, .ReloadIgnoringLocalAndRemoteCacheData:
+            return nil
+        default:
+            return responseCache.cachedResponseHeadForRequest(URLRequest)
+        }
+    }
+
+    private func cachedRequest(URLRequest: NSURLRequest) -> Request {
+        var dataTask: NSURLSessionDataTask!
+
+        dispatch_sync(queue) {
+            dataTask = self.session.dataTaskWithRequest(URLRequest)
+        }
+
+        let request = Request(session: session, task: dataTask)
+        prepareRequest(request)
+
+        // The task is never registered, and cancelling it keeps a later `resume()` from reaching the network
+        dataTask.cancel()
+
+        guard let responseCache = responseCache else { return request }
+
+        // The first operation, so the body reaches a stream closure set after this returns before any response handler
+        request.delegate.handlerQueue.addOperationWithBlock {
+            (request.delegate as? Request.DataTaskDelegate)?.replayCachedResponse()
+        }
+
+        // Response handlers stay on hold until the body has been read from disk
+        responseCache.cachedResponseForRequest(URLRequest) { storedResponse in
+            let delegate = request.delegate
+
+            if let storedResponse = storedResponse {
+                delegate.cachedResponse = storedResponse
+                delegate.progress.totalUnitCount = Int64(storedResponse.data.length)
+                delegate.progress.completedUnitCount = Int64(storedResponse.data.length)
+            } else {
+                // The entry was evicted or its body removed since the index was consulted
+                delegate.error = NSError(domain: NSURLErrorDomain, code: NSURLErrorResourceUnavailable, userInfo: nil)
+            }
+
+            delegate.handlerQueue.suspended = false
+        }
+
+        return request
+    }
+
+    private func revalidateCachedResponse(cachedResponse: CachedResponse, forRequest URLRequest: NSURLRequest) {
+        guard let
+            responseCache = responseCache,
+            URLString = URLRequest.URL?.absoluteString,
+            conditionalURLRequest = URLRequest.mutableCopy() as? NSMutableURLRequest else
+        {
+            return
+        }
+
+        var isRevalidating = false
+
+        dispatch_sync(queue) {
+            isRevalidating = self.revalidatingURLStrings.contains(URLString)
+            self.revalidatingURLStrings.insert(URLString)
+        }
+
+        guard !isRevalidating else { return }
+
+        responseCache.addValidatorsToRequest(conditionalURLRequest, cachedResponse: cachedResponse)
+        conditionalURLRequest.cachePolicy = .ReloadIgnoringLocalCacheData
+
+        let request = dataRequest(conditionalURLRequest)
+        cacheResponseOfRequest(request)
+
+        request.delegate.handlerQueue.addOperationWithBlock { [weak self] in
+            guard let strongSelf = self else { return }
+            dispatch_async(strongSelf.queue) { strongSelf.revalidatingURLStrings.remove(URLString) }
+        }
+
+        request.resume()
+    }
+
+    private func cacheResponseOfRequest(request: Request) {
+        guard let
+            responseCache = responseCache,
+            URLRequest = request.request
+            where URLRequest.HTTPMethod == Method.GET.rawValue && !sessionSendsAuthorization else
+        {
+            return
+        }
+
+        // The first operation on the delegate queue runs as soon as the task completes, before any response handler
+        request.delegate.handlerQueue.addOperationWithBlock {
+            guard let response = request.task.response as? NSHTTPURLResponse where request.delegate.error == nil else {
+                return
+            }
+
+            if response.statusCode == 304 {
+                request.delegate.cachedResponse = responseCache.refreshResponse(response, forRequest: URLRequest)
+                (request.delegate as? Request.DataTaskDelegate)?.replayCachedResponse()
+            } else if let data = request.delegate.data {
+                responseCache.storeResponse(response, data: data, forRequest: URLRequest)
+            }
+        }
+    }
+
     // MARK: - SessionDelegate
 
     /**
         Responsible for handling all delegate callbacks for the underlying session.
     */
     public final class SessionDelegate: NSObject, NSURLSessionDelegate, NSURLSessionTaskDelegate, NSURLSessionDataDelegate, NSURLSessionDownloadDelegate {
-        private var subdelegates: [Int: Request.TaskDelegate] = [:]
-        private let subdelegateQueue = dispatch_queue_create(nil, DISPATCH_QUEUE_CONCURRENT)
+        private let subdelegates = TaskDelegateRegistry()
 
         subscript(task: NSURLSessionTask) -> Request.TaskDelegate? {
             get {
-                var subdelegate: Request.TaskDelegate?
-                dispatch_sync(subdelegateQueue) {
-                    subdelegate = self.subdelegates[task.taskIdentifier]
-                }
-
-                return subdelegate
+                return subdelegates[task.taskIdentifier]
             }
 
             set {
-                dispatch_barrier_async(subdelegateQueue) {
-                    self.subdelegates[task.taskIdentifier] = newValue
-                }
+                subdelegates[task.taskIdentifier] = newValue
             }
         }
 
@@ -706,3 +1037,80 @@ public class Manager {
         }
     }
 }
+
+// MARK: - TaskDelegateRegistry
+
+/**
+    A thread-safe map from task identifiers to task delegates, split into independently locked shards.
+
+    Every session and task delegate callback looks up its task delegate, so lookups must be cheap and callbacks for 
+    different tasks must not wait on each other. Each shard is guarded by its own mutex, held only for the dictionary 
+    access itself, and task identifiers, which the session assigns sequentially, spread evenly across the shards.
+*/
+final class TaskDelegateRegistry {
+    private final class Shard {
+        let mutex = UnsafeMutablePointer<pthread_mutex_t>.alloc(1)
+        var delegates: [Int: Request.TaskDelegate] = [:]
+
+        init() {
+            pthread_mutex_init(mutex, nil)
+        }
+
+        deinit {
+            pthread_mutex_destroy(mutex)
+            mutex.dealloc(1)
+        }
+    }
+
+    private let shards: [Shard]
+    private let shardMask: Int
+
+    /**
+        Initializes the `TaskDelegateRegistry` instance with the specified number of shards.
+
+        - parameter shardCount: The number of shards, rounded up to a power of two. `16` by default.
+
+        - returns: The new `TaskDelegateRegistry` instance.
+    */
+    init(shardCount: Int = 16) {
+        var count = 1
+
+        while count < shardCount {
+            count <<= 1
+        }
+
+        self.shards = (0..<count).map { _ in Shard() }
+        self.shardMask = count - 1
+    }
+
+    subscript(taskIdentifier: Int) -> Request.TaskDelegate? {
+        get {
+            let shard = shards[taskIdentifier & shardMask]
+
+            pthread_mutex_lock(shard.mutex)
+            let delegate = shard.delegates[taskIdentifier]
+            pthread_mutex_unlock(shard.mutex)
+
+            return delegate
+        }
+
+        set {
+            let shard = shards[taskIdentifier & shardMask]
+
+            pthread_mutex_lock(shard.mutex)
+            shard.delegates[taskIdentifier] = newValue
+            pthread_mutex_unlock(shard.mutex)
+        }
+    }
+
+    /// The number of registered task delegates.
+    var count: Int {
+        return shards.reduce(0) { count, shard in
+            pthread_mutex_lock(shard.mutex)
+            let shardCount = shard.delegates.count
+            pthread_mutex_unlock(shard.mutex)
+
+            return count + shardCount
+        }
+    }
+}
@@ -79,13 +79,16 @@ public class MultipartFormData {
         let headers: [String: String]
         let bodyStream: NSInputStream
         let bodyContentLength: UInt64
+        let fileURL: NSURL?
+        var hasExactContentLength = false
         var hasInitialBoundary = false
         var hasFinalBoundary = false
 
-        init(headers: [String: String], bodyStream: NSInputStream, bodyContentLength: UInt64) {
+        init(headers: [String: String], bodyStream: NSInputStream, bodyContentLength: UInt64, fileURL: NSURL? = nil) {
             self.headers = headers
             self.bodyStream = bodyStream
             self.bodyContentLength = bodyContentLength
+            self.fileURL = fileURL
         }
     }
 
@@ -102,26 +105,25 @@ public class MultipartFormData {
 
     private var bodyParts: [BodyPart]
     private var bodyPartError: NSError?
-    private let streamBufferSize: Int
+    private let bufferPool: BufferPool
+
+    // The most memory reserved up front for a body part stream, whatever length it was appended with
+    private static let maximumPreallocatedCapacity: UInt64 = 1024 * 1024
 
     // MARK: - Lifecycle
 
     /**
         Creates a multipart form data object.
 
+        - parameter bufferPool: The pool of the buffers body part streams and files are read into when encoding. 
+                                `BufferPool.sharedPool` by default.
+
         - returns: The multipart form data object.
     */
-    public init() {
+    public init(bufferPool: BufferPool = BufferPool.sharedPool) {
         self.boundary = BoundaryGenerator.randomBoundary()
         self.bodyParts = []
-
-        /**
-         *  The optimal read/write buffer size in bytes for input and output streams is 1024 (1KB). For more 
-         *  information, please refer to the following article:
-         *    - https://developer.apple.com/library/mac/documentation/Cocoa/Conceptual/Streams/Articles/ReadingInputStreams.html
-         */
-
-        self.streamBufferSize = 1024
+        self.bufferPool = bufferPool
     }
 
     // MARK: - Body Parts
@@ -140,10 +142,7 @@ public class MultipartFormData {
     */
     public func appendBodyPart(data data: NSData, name: String) {
         let headers = contentHeaders(name: name)
-        let stream = NSInputStream(data: data)
-        let length = UInt64(data.length)
-
-        appendBodyPart(stream: stream, length: length, headers: headers)
+        appendBodyPart(data: data, headers: headers)
     }
 
     /**
@@ -162,10 +161,7 @@ public class MultipartFormData {
     */
     public func appendBodyPart(data data: NSData, name: String, mimeType: String) {
         let headers = contentHeaders(name: name, mimeType: mimeType)
-        let stream = NSInputStream(data: data)
-        let length = UInt64(data.length)
-
-        appendBodyPart(stream: stream, length: length, headers: headers)
+        appendBodyPart(data: data, headers: headers)
     }
 
     /**
@@ -185,10 +181,7 @@ public class MultipartFormData {
     */
     public func appendBodyPart(data data: NSData, name: String, fileName: String, mimeType: String) {
         let headers = contentHeaders(name: name, fileName: fileName, mimeType: mimeType)
-        let stream = NSInputStream(data: data)
-        let length = UInt64(data.length)
-
-        appendBodyPart(stream: stream, length: length, headers: headers)
+        appendBodyPart(data: data, headers: headers)
     }
 
     /**
@@ -317,7 +310,9 @@ public class MultipartFormData {
             return
         }
 
-        appendBodyPart(stream: stream, length: length, headers: headers)
+        let bodyPart = BodyPart(headers: headers, bodyStream: stream, bodyContentLength: length, fileURL: fileURL)
+        bodyPart.hasExactContentLength = true
+        bodyParts.append(bodyPart)
     }
 
     /**
@@ -365,6 +360,12 @@ public class MultipartFormData {
         bodyParts.append(bodyPart)
     }
 
+    private func appendBodyPart(data data: NSData, headers: [String: String]) {
+        let bodyPart = BodyPart(headers: headers, bodyStream: NSInputStream(data: data), bodyContentLength: UInt64(data.length))
+        bodyPart.hasExactContentLength = true
+        bodyParts.append(bodyPart)
+    }
+
     // MARK: - Data Encoding
 
     /**
@@ -399,47 +400,168 @@ public class MultipartFormData {
     /**
         Writes the appended body parts into the given file URL.
 
-        This process is facilitated by reading and writing with input and output streams, respectively. Thus,
-        this approach is very memory efficient and should be used for large body part data.
+        Body parts are copied through a buffer from the buffer pool straight to the file descriptor of the file, and 
+        file body parts are read from their file descriptors rather than through input streams. Thus, this approach 
+        is very memory efficient and should be used for large body part data.
 
         - parameter fileURL: The file URL to write the multipart form data into.
 
         - throws: An `NSError` if encoding encounters an error.
     */
     public func writeEncodedDataToDisk(fileURL: NSURL) throws {
-        if let bodyPartError = bodyPartError {
-            throw bodyPartError
+        let fileDescriptor = try openFileForWritingAtURL(fileURL)
+        defer { close(fileDescriptor) }
+
+        self.bodyParts.first?.hasInitialBoundary = true
+        self.bodyParts.last?.hasFinalBoundary = true
+
+        var fileWriter = FileWriter(fileDescriptor: fileDescriptor)
+
+        for bodyPart in self.bodyParts {
+            try writeBodyPart(bodyPart, toFileWriter: &fileWriter)
         }
+    }
 
-        if let path = fileURL.path where NSFileManager.defaultManager().fileExistsAtPath(path) {
-            let failureReason = "A file already exists at the given file URL: \(fileURL)"
-            throw Error.errorWithCode(NSURLErrorBadURL, failureReason: failureReason)
-        } else if !fileURL.fileURL {
-            let failureReason = "The URL does not point to a valid file: \(fileURL)"
-            throw Error.errorWithCode(NSURLErrorBadURL, failureReason: failureReason)
+    /**
+        Writes the appended body parts into the given file URL, encoding several body parts at the same time.
+
+        The offset of each body part in the file is computed up front from the boundaries, the headers and the content 
+        length of the body parts. The file is then preallocated, and each body part is read and written into its own 
+        range of the file on a concurrent queue. The encoded data is identical to the one written by 
+        `writeEncodedDataToDisk(_:)`.
+
+        Body parts appended from streams only declare their length, so if any is present the body parts are written 
+        one after the other instead.
+
+        - parameter fileURL:                    The file URL to write the multipart form data into.
+        - parameter maximumConcurrentBodyParts: The maximum number of body parts encoded at the same time.
+
+        - throws: An `NSError` if encoding encounters an error, or if the length of a file changed since its body part 
+                  was appended.
+    */
+    public func writeEncodedDataToDisk(fileURL: NSURL, maximumConcurrentBodyParts: Int) throws {
+        let concurrentBodyPartCount = min(maximumConcurrentBodyParts, bodyParts.count)
+
+        guard concurrentBodyPartCount > 1 && bodyParts.filter({ !$0.hasExactContentLength }).isEmpty else {
+            return try writeEncodedDataToDisk(fileURL)
         }
 
-        let outputStream: NSOutputStream
+        let fileDescriptor = try openFileForWritingAtURL(fileURL)
+        defer { close(fileDescriptor) }
 
-        if let possibleOutputStream = NSOutputStream(URL: fileURL, append: false) {
-            outputStream = possibleOutputStream
-        } else {
-            let failureReason = "Failed to create an output stream with the given URL: \(fileURL)"
-            throw Error.errorWithCode(NSURLErrorCannotOpenFile, failureReason: failureReason)
+        bodyParts.first?.hasInitialBoundary = true
+        bodyParts.last?.hasFinalBoundary = true
+
+        var offsets: [off_t] = []
+        var length: off_t = 0
+
+        for bodyPart in bodyParts {
+            offsets.append(length)
+
+            let initialData = bodyPart.hasInitialBoundary ? initialBoundaryData() : encapsulatedBoundaryData()
+            length += off_t(initialData.length + encodeHeaderDataForBodyPart(bodyPart).length)
+            length += off_t(bodyPart.bodyContentLength)
+
+            if bodyPart.hasFinalBoundary {
+                length += off_t(finalBoundaryData().length)
+            }
         }
 
-        outputStream.scheduleInRunLoop(NSRunLoop.currentRunLoop(), forMode: NSDefaultRunLoopMode)
-        outputStream.open()
+        guard ftruncate(fileDescriptor, length) == 0 else {
+            let failureReason = "Failed to allocate \(length) bytes for the file: \(fileURL)"
+            throw Error.errorWithCode(.OutputStreamWriteFailed, failureReason: failureReason)
+        }
 
-        self.bodyParts.first?.hasInitialBoundary = true
-        self.bodyParts.last?.hasFinalBoundary = true
+        let bodyParts = self.bodyParts
+        let nextIndex = UnsafeMutablePointer<Int32>.alloc(1)
+        nextIndex.initialize(-1)
+        defer { nextIndex.dealloc(1) }
 
-        for bodyPart in self.bodyParts {
-            try writeBodyPart(bodyPart, toOutputStream: outputStream)
+        let errorLock = NSLock()
+        var firstError: ErrorType?
+
+        // Each worker takes the next body part until none is left, so at most the maximum are encoded at once
+        dispatch_apply(concurrentBodyPartCount, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0)) { _ in
+            while true {
+                let index = Int(OSAtomicIncrement32Barrier(nextIndex))
+                guard index < bodyParts.count else { break }
+
+                var fileWriter = FileWriter(fileDescriptor: fileDescriptor, offset: offsets[index])
+
+                do {
+                    try self.writeBodyPart(bodyParts[index], toFileWriter: &fileWriter)
+                } catch {
+                    errorLock.lock()
+                    firstError = firstError ?? error
+                    errorLock.unlock()
+
+                    break
+                }
+            }
+        }
+
+        if let firstError = firstError {
+            throw firstError
+        }
+    }
+
+    // MARK: - Stream Encoding
+
+    /**
+        The length in bytes of the encoded form data, including the boundaries and body part headers.
+
+        This is the length of both the encoded data and the encoded stream, and is suitable for the `Content-Length` 
+        HTTP header of an upload.
+    */
+    public var encodedContentLength: UInt64 {
+        guard !bodyParts.isEmpty else { return 0 }
+
+        var length = UInt64(initialBoundaryData().length + finalBoundaryData().length)
+        length += UInt64(encapsulatedBoundaryData().length * (bodyParts.count - 1))
+
+        for bodyPart in bodyParts {
+            length += UInt64(encodeHeaderDataForBodyPart(bodyPart).length) + bodyPart.bodyContentLength
         }
 
-        outputStream.close()
-        outputStream.removeFromRunLoop(NSRunLoop.currentRunLoop(), forMode: NSDefaultRunLoopMode)
+        return length
+    }
+
+    /**
+        Creates an input stream that encodes the appended body parts as it is read.
+
+        The boundaries and headers are produced on demand and each body part stream is read straight into the buffer 
+        passed to the encoded stream, so neither the payload nor any part of it is copied into memory or written to 
+        disk ahead of time. This makes it suitable for uploads of any size with `upload(_:stream:)`, in combination 
+        with the `contentType` and `encodedContentLength` properties.
+
+        The body part streams are consumed as the encoded stream is read, so the form data can only be encoded once.
+
+        - throws: An `NSError` if appending a body part encountered an error.
+
+        - returns: The encoded `NSInputStream`.
+    */
+    public func encodedStream() throws -> NSInputStream {
+        if let bodyPartError = bodyPartError {
+            throw bodyPartError
+        }
+
+        var segments: [EncodedInputStream.Segment] = []
+
+        bodyParts.first?.hasInitialBoundary = true
+        bodyParts.last?.hasFinalBoundary = true
+
+        for bodyPart in bodyParts {
+            let initialData = bodyPart.hasInitialBoundary ? initialBoundaryData() : encapsulatedBoundaryData()
+            segments.append(.Data(initialData))
+            segments.append(.Data(encodeHeaderDataForBodyPart(bodyPart)))
+            segments.append(.Stream(bodyPart.bodyStream))
+
+            if bodyPart.hasFinalBoundary {
+                segments.append(.Data(finalBoundaryData()))
+            }
+        }
+
+        return EncodedInputStream(segments: segments)
     }
 
     // MARK: - Private - Body Part Encoding
@@ -479,32 +601,36 @@ public class MultipartFormData {
         inputStream.scheduleInRunLoop(NSRunLoop.currentRunLoop(), forMode: NSDefaultRunLoopMode)
         inputStream.open()
 
+        defer {
+            inputStream.close()
+            inputStream.removeFromRunLoop(NSRunLoop.currentRunLoop(), forMode: NSDefaultRunLoopMode)
+        }
+
         var error: NSError?
-        let encoded = NSMutableData()
+        let capacity = min(bodyPart.bodyContentLength, MultipartFormData.maximumPreallocatedCapacity)
+        let encoded = NSMutableData(capacity: Int(capacity)) ?? NSMutableData()
 
-        while inputStream.hasBytesAvailable {
-            var buffer = [UInt8](count: streamBufferSize, repeatedValue: 0)
-            let bytesRead = inputStream.read(&buffer, maxLength: streamBufferSize)
+        try bufferPool.withBuffer { buffer in
+            while inputStream.hasBytesAvailable {
+                let bytesRead = inputStream.read(buffer, maxLength: bufferPool.bufferSize)
 
-            if inputStream.streamError != nil {
-                error = inputStream.streamError
-                break
-            }
+                if inputStream.streamError != nil {
+                    error = inputStream.streamError
+                    break
+                }
 
-            if bytesRead > 0 {
-                encoded.appendBytes(buffer, length: bytesRead)
-            } else if bytesRead < 0 {
-                let failureReason = "Failed to read from input stream: \(inputStream)"
-                error = Error.errorWithCode(.InputStreamReadFailed, failureReason: failureReason)
-                break
-            } else {
-                break
+                if bytesRead > 0 {
+                    encoded.appendBytes(buffer, length: bytesRead)
+                } else if bytesRead < 0 {
+                    let failureReason = "Failed to read from input stream: \(inputStream)"
+                    error = Error.errorWithCode(.InputStreamReadFailed, failureReason: failureReason)
+                    break
+                } else {
+                    break
+                }
             }
         }
 
-        inputStream.close()
-        inputStream.removeFromRunLoop(NSRunLoop.currentRunLoop(), forMode: NSDefaultRunLoopMode)
-
         if let error = error {
             throw error
         }
@@ -512,104 +638,187 @@ public class MultipartFormData {
         return encoded
     }
 
-    // MARK: - Private - Writing Body Part to Output Stream
+    // MARK: - Private - Writing Body Part to File
 
-    private func writeBodyPart(bodyPart: BodyPart, toOutputStream outputStream: NSOutputStream) throws {
-        try writeInitialBoundaryDataForBodyPart(bodyPart, toOutputStream: outputStream)
-        try writeHeaderDataForBodyPart(bodyPart, toOutputStream: outputStream)
-        try writeBodyStreamForBodyPart(bodyPart, toOutputStream: outputStream)
-        try writeFinalBoundaryDataForBodyPart(bodyPart, toOutputStream: outputStream)
-    }
+    /// Writes to a file descriptor at its current position, or at an explicit offset advanced by each write.
+    private struct FileWriter {
+        let fileDescriptor: Int32
+        var offset: off_t?
+        var bytesWritten: UInt64 = 0
 
-    private func writeInitialBoundaryDataForBodyPart(
-        bodyPart: BodyPart,
-        toOutputStream outputStream: NSOutputStream)
-        throws
-    {
-        let initialData = bodyPart.hasInitialBoundary ? initialBoundaryData() : encapsulatedBoundaryData()
-        return try writeData(initialData, toOutputStream: outputStream)
-    }
+        init(fileDescriptor: Int32, offset: off_t? = nil) {
+            self.fileDescriptor = fileDescriptor
+            self.offset = offset
+        }
 
-    private func writeHeaderDataForBodyPart(bodyPart: BodyPart, toOutputStream outputStream: NSOutputStream) throws {
-        let headerData = encodeHeaderDataForBodyPart(bodyPart)
-        return try writeData(headerData, toOutputStream: outputStream)
-    }
+        mutating func writeData(data: NSData) throws {
+            try writeBytes(UnsafePointer<UInt8>(data.bytes), length: data.length)
+        }
 
-    private func writeBodyStreamForBodyPart(bodyPart: BodyPart, toOutputStream outputStream: NSOutputStream) throws {
-        let inputStream = bodyPart.bodyStream
-        inputStream.scheduleInRunLoop(NSRunLoop.currentRunLoop(), forMode: NSDefaultRunLoopMode)
-        inputStream.open()
+        mutating func writeBytes(bytes: UnsafePointer<UInt8>, length: Int) throws {
+            var bytesWritten = 0
 
-        while inputStream.hasBytesAvailable {
-            var buffer = [UInt8](count: streamBufferSize, repeatedValue: 0)
-            let bytesRead = inputStream.read(&buffer, maxLength: streamBufferSize)
+            // Partial writes advance through the buffer rather than copying what is left of it
+            while bytesWritten < length {
+                let result: Int
 
-            if let streamError = inputStream.streamError {
-                throw streamError
-            }
-
-            if bytesRead > 0 {
-                if buffer.count != bytesRead {
-                    buffer = Array(buffer[0..<bytesRead])
+                if let offset = offset {
+                    result = pwrite(fileDescriptor, bytes + bytesWritten, length - bytesWritten, offset + off_t(bytesWritten))
+                } else {
+                    result = write(fileDescriptor, bytes + bytesWritten, length - bytesWritten)
                 }
 
-                try writeBuffer(&buffer, toOutputStream: outputStream)
-            } else if bytesRead < 0 {
-                let failureReason = "Failed to read from input stream: \(inputStream)"
-                throw Error.errorWithCode(.InputStreamReadFailed, failureReason: failureReason)
-            } else {
-                break
+                if result >= 0 {
+                    bytesWritten += result
+                } else if errno != EINTR {
+                    let failureReason = "Failed to write to the file: \(String.fromCString(strerror(errno)) ?? "")"
+                    throw Error.errorWithCode(.OutputStreamWriteFailed, failureReason: failureReason)
+                }
             }
+
+            offset = offset.map { $0 + off_t(length) }
+            self.bytesWritten += UInt64(length)
+        }
+    }
+
+    private func openFileForWritingAtURL(fileURL: NSURL) throws -> Int32 {
+        if let bodyPartError = bodyPartError {
+            throw bodyPartError
+        }
+
+        if let path = fileURL.path where NSFileManager.defaultManager().fileExistsAtPath(path) {
+            let failureReason = "A file already exists at the given file URL: \(fileURL)"
+            throw Error.errorWithCode(NSURLErrorBadURL, failureReason: failureReason)
+        } else if !fileURL.fileURL {
+            let failureReason = "The URL does not point to a valid file: \(fileURL)"
+            throw Error.errorWithCode(NSURLErrorBadURL, failureReason: failureReason)
+        }
+
+        let fileDescriptor = fileURL.path.map { open($0, O_WRONLY | O_CREAT | O_TRUNC, 0o644) } ?? -1
+
+        guard fileDescriptor >= 0 else {
+            let failureReason = "Failed to open a file for writing with the given URL: \(fileURL)"
+            throw Error.errorWithCode(NSURLErrorCannotOpenFile, failureReason: failureReason)
         }
 
-        inputStream.close()
-        inputStream.removeFromRunLoop(NSRunLoop.currentRunLoop(), forMode: NSDefaultRunLoopMode)
+        return fileDescriptor
     }
 
-    private func writeFinalBoundaryDataForBodyPart(
-        bodyPart: BodyPart,
-        toOutputStream outputStream: NSOutputStream)
-        throws
-    {
+    private func writeBodyPart(bodyPart: BodyPart, inout toFileWriter fileWriter: FileWriter) throws {
+        let initialData = bodyPart.hasInitialBoundary ? initialBoundaryData() : encapsulatedBoundaryData()
+        try fileWriter.writeData(initialData)
+        try fileWriter.writeData(encodeHeaderDataForBodyPart(bodyPart))
+
+        // A body part written at an offset must fill its range exactly, or it would overlap the next one
+        let byteLimit: UInt64? = fileWriter.offset != nil ? bodyPart.bodyContentLength : nil
+
+        if let path = bodyPart.fileURL?.path {
+            try copyFileAtPath(path, byteLimit: byteLimit, toFileWriter: &fileWriter)
+        } else {
+            try writeBodyStreamForBodyPart(bodyPart, byteLimit: byteLimit, toFileWriter: &fileWriter)
+        }
+
         if bodyPart.hasFinalBoundary {
-            return try writeData(finalBoundaryData(), toOutputStream: outputStream)
+            try fileWriter.writeData(finalBoundaryData())
         }
     }
 
-    // MARK: - Private - Writing Buffered Data to Output Stream
+    private func copyFileAtPath(path: String, byteLimit: UInt64?, inout toFileWriter fileWriter: FileWriter) throws {
+        let sourceFileDescriptor = open(path, O_RDONLY)
+
+        guard sourceFileDescriptor >= 0 else {
+            let failureReason = "Failed to open the file for reading: \(path)"
+            throw Error.errorWithCode(NSURLErrorCannotOpenFile, failureReason: failureReason)
+        }
+
+        defer { close(sourceFileDescriptor) }
+
+        var bytesLeft = byteLimit
 
-    private func writeData(data: NSData, toOutputStream outputStream: NSOutputStream) throws {
-        var buffer = [UInt8](count: data.length, repeatedValue: 0)
-        data.getBytes(&buffer, length: data.length)
+        try bufferPool.withBuffer { buffer in
+            while true {
+                let bytesRead = read(sourceFileDescriptor, buffer, maximumReadLengthWithBytesLeft(bytesLeft))
 
-        return try writeBuffer(&buffer, toOutputStream: outputStream)
+                if bytesRead > 0 {
+                    try consumeBytesRead(bytesRead, bytesLeft: &bytesLeft)
+                    try fileWriter.writeBytes(buffer, length: bytesRead)
+                } else if bytesRead < 0 && errno == EINTR {
+                    continue
+                } else if bytesRead < 0 {
+                    let failureReason = "Failed to read from the file: \(path)"
+                    throw Error.errorWithCode(.InputStreamReadFailed, failureReason: failureReason)
+                } else {
+                    break
+                }
+            }
+        }
+
+        try checkBytesLeft(bytesLeft)
     }
 
-    private func writeBuffer(inout buffer: [UInt8], toOutputStream outputStream: NSOutputStream) throws {
-        var bytesToWrite = buffer.count
+    private func writeBodyStreamForBodyPart(
+        bodyPart: BodyPart,
+        byteLimit: UInt64?,
+        inout toFileWriter fileWriter: FileWriter)
+        throws
+    {
+        let inputStream = bodyPart.bodyStream
+        inputStream.scheduleInRunLoop(NSRunLoop.currentRunLoop(), forMode: NSDefaultRunLoopMode)
+        inputStream.open()
 
-        while bytesToWrite > 0 {
-            if outputStream.hasSpaceAvailable {
-                let bytesWritten = outputStream.write(buffer, maxLength: bytesToWrite)
+        defer {
+            inputStream.close()
+            inputStream.removeFromRunLoop(NSRunLoop.currentRunLoop(), forMode: NSDefaultRunLoopMode)
+        }
 
-                if let streamError = outputStream.streamError {
+        var bytesLeft = byteLimit
+
+        try bufferPool.withBuffer { buffer in
+            while inputStream.hasBytesAvailable {
+                let bytesRead = inputStream.read(buffer, maxLength: maximumReadLengthWithBytesLeft(bytesLeft))
+
+                if let streamError = inputStream.streamError {
                     throw streamError
                 }
 
-                if bytesWritten < 0 {
-                    let failureReason = "Failed to write to output stream: \(outputStream)"
-                    throw Error.errorWithCode(.OutputStreamWriteFailed, failureReason: failureReason)
+                if bytesRead > 0 {
+                    try consumeBytesRead(bytesRead, bytesLeft: &bytesLeft)
+                    try fileWriter.writeBytes(buffer, length: bytesRead)
+                } else if bytesRead < 0 {
+                    let failureReason = "Failed to read from input stream: \(inputStream)"
+                    throw Error.errorWithCode(.InputStreamReadFailed, failureReason: failureReason)
+                } else {
+                    break
                 }
+            }
+        }
+
+        try checkBytesLeft(bytesLeft)
+    }
 
-                bytesToWrite -= bytesWritten
+    private func maximumReadLengthWithBytesLeft(bytesLeft: UInt64?) -> Int {
+        guard let bytesLeft = bytesLeft else { return bufferPool.bufferSize }
 
-                if bytesToWrite > 0 {
-                    buffer = Array(buffer[bytesWritten..<buffer.count])
-                }
-            } else if let streamError = outputStream.streamError {
-                throw streamError
-            }
+        // One byte past the limit is asked for, so that a longer body part is told apart from one that ends in time
+        return Int(min(UInt64(bufferPool.bufferSize), bytesLeft + 1))
+    }
+
+    private func consumeBytesRead(bytesRead: Int, inout bytesLeft: UInt64?) throws {
+        guard let limit = bytesLeft else { return }
+
+        guard UInt64(bytesRead) <= limit else {
+            let failureReason = "The body part is longer than the length it was appended with"
+            throw Error.errorWithCode(.InputStreamReadFailed, failureReason: failureReason)
         }
+
+        bytesLeft = limit - UInt64(bytesRead)
+    }
+
+    private func checkBytesLeft(bytesLeft: UInt64?) throws {
+        guard let bytesLeft = bytesLeft where bytesLeft > 0 else { return }
+
+        let failureReason = "The body part ended \(bytesLeft) bytes short of the length it was appended with"
+        throw Error.errorWithCode(.InputStreamReadFailed, failureReason: failureReason)
     }
 
     // MARK: - Private - Mime Type
@@ -667,3 +876,147 @@ public class MultipartFormData {
         }
     }
 }
+
+// MARK: - EncodedInputStream
+
+extension MultipartFormData {
+
+    /**
+        A pull-based input stream serving the encoded form data as a sequence of segments: boundary and header data 
+        held in memory, and the body part streams themselves.
+    */
+    final class EncodedInputStream: NSInputStream {
+        enum Segment {
+            case Data(NSData)
+            case Stream(NSInputStream)
+        }
+
+        private let segments: [Segment]
+        private var segmentIndex = 0
+        private var dataOffset = 0
+
+        private var status: NSStreamStatus = .NotOpen
+        private var error: NSError?
+        private weak var streamDelegate: NSStreamDelegate?
+
+        init(segments: [Segment]) {
+            self.segments = segments
+            super.init(data: NSData())
+        }
+
+        // MARK: - NSStream
+
+        override var streamStatus: NSStreamStatus { return status }
+        override var streamError: NSError? { return error }
+
+        override var delegate: NSStreamDelegate? {
+            get { return streamDelegate }
+            set { streamDelegate = newValue }
+        }
+
+        override func open() {
+            guard status == .NotOpen else { return }
+            status = segments.isEmpty ? .AtEnd : .Open
+        }
+
+        override func close() {
+            if segmentIndex < segments.count, case .Stream(let stream) = segments[segmentIndex] {
+                stream.close()
+            }
+
+            status = .Closed
+        }
+
+        override func propertyForKey(key: String) -> AnyObject? {
+            return nil
+        }
+
+        override func setProperty(property: AnyObject?, forKey key: String) -> Bool {
+            return false
+        }
+
+        override func scheduleInRunLoop(aRunLoop: NSRunLoop, forMode mode: String) {}
+
+        override func removeFromRunLoop(aRunLoop: NSRunLoop, forMode mode: String) {}
+
+        // MARK: - NSInputStream
+
+        override var hasBytesAvailable: Bool {
+            return status == .Open
+        }
+
+        override func getBuffer(buffer: UnsafeMutablePointer<UnsafeMutablePointer<UInt8>>, length len: UnsafeMutablePointer<Int>) -> Bool {
+            return false
+        }
+
+        override func read(buffer: UnsafeMutablePointer<UInt8>, maxLength len: Int) -> Int {
+            if status == .AtEnd || status == .Closed {
+                return 0
+            } else if status != .Open {
+                return -1
+            }
+
+            status = .Reading
+
+            var bytesRead = 0
+
+            while bytesRead < len && segmentIndex < segments.count {
+                switch segments[segmentIndex] {
+                case .Data(let data):
+                    let length = min(data.length - dataOffset, len - bytesRead)
+                    data.getBytes(buffer + bytesRead, range: NSRange(location: dataOffset, length: length))
+
+                    bytesRead += length
+                    dataOffset += length
+
+                    if dataOffset == data.length {
+                        segmentIndex += 1
+                        dataOffset = 0
+                    }
+                case .Stream(let stream):
+                    if stream.streamStatus == .NotOpen {
+                        stream.open()
+                    }
+
+                    let result = stream.read(buffer + bytesRead, maxLength: len - bytesRead)
+
+                    if result > 0 {
+                        bytesRead += result
+                    } else if result == 0 {
+                        stream.close()
+                        segmentIndex += 1
+                    } else {
+                        let failureReason = "Failed to read from input stream: \(stream)"
+                        error = stream.streamError ?? Error.errorWithCode(.InputStreamReadFailed, failureReason: failureReason)
+                        status = .Error
+                        stream.close()
+
+                        return -1
+                    }
+                }
+            }
+
+            status = segmentIndex < segments.count ? .Open : .AtEnd
+
+            return bytesRead
+        }
+
+        // MARK: - CFReadStream Bridging
+
+        // `NSURLSession` drives body streams through `CFReadStream`, which calls these private methods on
+        // `NSInputStream` subclasses. Reads are synchronous, so there is nothing to schedule.
+
+        func _scheduleInCFRunLoop(runLoop: CFRunLoop, forMode mode: CFString) {}
+
+        func _unscheduleFromCFRunLoop(runLoop: CFRunLoop, forMode mode: CFString) {}
+
+        func _setCFClientFlags(
+            flags: CFOptionFlags,
+            callback: CFReadStreamClientCallBack,
+            context: UnsafeMutablePointer<CFStreamClientContext>)
+            -> Bool
+        {
+            return false
+        }
+    }
+}
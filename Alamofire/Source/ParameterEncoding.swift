@@ -90,7 +90,11 @@ public enum ParameterEncoding {
 
         switch self {
         case .URL, .URLEncodedInURL:
-            func query(parameters: [String: AnyObject]) -> String {
+            func queryBytes(parameters: [String: AnyObject]) -> [UInt8] {
+                if let bytes = QueryStringEncoder.encode(parameters) {
+                    return bytes
+                }
+
                 var components: [(String, String)] = []
 
                 for key in parameters.keys.sort(<) {
@@ -98,7 +102,7 @@ public enum ParameterEncoding {
                     components += queryComponents(key, value)
                 }
 
-                return (components.map { "\($0)=\($1)" } as [String]).joinWithSeparator("&")
+                return Array((components.map { "\($0)=\($1)" } as [String]).joinWithSeparator("&").utf8)
             }
 
             func encodesParametersInURL(method: Method) -> Bool {
@@ -119,7 +123,8 @@ public enum ParameterEncoding {
 
             if let method = Method(rawValue: mutableURLRequest.HTTPMethod) where encodesParametersInURL(method) {
                 if let URLComponents = NSURLComponents(URL: mutableURLRequest.URL!, resolvingAgainstBaseURL: false) {
-                    let percentEncodedQuery = (URLComponents.percentEncodedQuery.map { $0 + "&" } ?? "") + query(parameters)
+                    let query = String(bytes: queryBytes(parameters), encoding: NSUTF8StringEncoding)!
+                    let percentEncodedQuery = (URLComponents.percentEncodedQuery.map { $0 + "&" } ?? "") + query
                     URLComponents.percentEncodedQuery = percentEncodedQuery
                     mutableURLRequest.URL = URLComponents.URL
                 }
@@ -131,10 +136,8 @@ public enum ParameterEncoding {
                     )
                 }
 
-                mutableURLRequest.HTTPBody = query(parameters).dataUsingEncoding(
-                    NSUTF8StringEncoding,
-                    allowLossyConversion: false
-                )
+                let bytes = queryBytes(parameters)
+                mutableURLRequest.HTTPBody = NSData(bytes: bytes, length: bytes.count)
             }
         case .JSON:
             do {
@@ -208,6 +211,17 @@ public enum ParameterEncoding {
         - returns: The percent-escaped string.
     */
     public func escape(string: String) -> String {
+        var bytes: [UInt8] = []
+        bytes.reserveCapacity(string.utf16.count)
+
+        if QueryStringEncoder.appendEscaped(string, to: &bytes) {
+            return String(bytes: bytes, encoding: NSUTF8StringEncoding)!
+        }
+
+        return escapeWithAllowedCharacterSet(string)
+    }
+
+    private func escapeWithAllowedCharacterSet(string: String) -> String {
         let generalDelimitersToEncode = ":#[]@" // does not include "?" or "/" due to RFC 3986 - Section 3.4
         let subDelimitersToEncode = "!$&'()*+,;="
 
@@ -249,3 +263,152 @@ public enum ParameterEncoding {
         return escaped
     }
 }
+
+// MARK: - QueryStringEncoder
+
+/**
+    Percent-escapes query strings byte by byte into a single UTF-8 buffer.
+
+    The output is identical to joining the `queryComponents(_:_:)` of the sorted parameters with `&` and `=`, but 
+    avoids building a character set, an intermediate string for every key and value and arrays of component tuples. 
+    Only ASCII letters, digits, `-._~`, `/` and `?` are left unescaped, matching `escape(_:)`.
+*/
+private struct QueryStringEncoder {
+    private static let allowedBytes: [Bool] = {
+        var allowedBytes = [Bool](count: 128, repeatedValue: false)
+
+        for byte in "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-._~/?".utf8 {
+            allowedBytes[Int(byte)] = true
+        }
+
+        return allowedBytes
+    }()
+
+    private static let hexDigits: [UInt8] = Array("0123456789ABCDEF".utf8)
+
+    private static let ampersand = UInt8(ascii: "&")
+    private static let equals = UInt8(ascii: "=")
+    private static let arrayKeySuffix: [UInt8] = Array("%5B%5D".utf8)
+    private static let nestedKeyPrefix: [UInt8] = Array("%5B".utf8)
+    private static let nestedKeySuffix: [UInt8] = Array("%5D".utf8)
+
+    /**
+        Encodes the parameters as a query string.
+
+        - parameter parameters: The parameters to encode.
+
+        - returns: The UTF-8 bytes of the query string, or `nil` if a key or value contains an unpaired UTF-16 
+                   surrogate, which `escape(_:)` leaves to Foundation.
+    */
+    static func encode(parameters: [String: AnyObject]) -> [UInt8]? {
+        var bytes: [UInt8] = []
+        bytes.reserveCapacity(parameters.count * 32)
+
+        for key in parameters.keys.sort(<) {
+            var escapedKey: [UInt8] = []
+
+            guard appendEscaped(key, to: &escapedKey) && appendComponents(escapedKey, parameters[key]!, to: &bytes) else {
+                return nil
+            }
+        }
+
+        return bytes
+    }
+
+    private static func appendComponents(escapedKey: [UInt8], _ value: AnyObject, inout to bytes: [UInt8]) -> Bool {
+        if let dictionary = value as? [String: AnyObject] {
+            for (nestedKey, value) in dictionary {
+                var nestedEscapedKey = escapedKey + nestedKeyPrefix
+
+                guard appendEscaped(nestedKey, to: &nestedEscapedKey) else { return false }
+
+                nestedEscapedKey.appendContentsOf(nestedKeySuffix)
+
+                guard appendComponents(nestedEscapedKey, value, to: &bytes) else { return false }
+            }
+        } else if let array = value as? [AnyObject] {
+            let arrayEscapedKey = escapedKey + arrayKeySuffix
+
+            for value in array {
+                guard appendComponents(arrayEscapedKey, value, to: &bytes) else { return false }
+            }
+        } else {
+            if !bytes.isEmpty {
+                bytes.append(ampersand)
+            }
+
+            bytes.appendContentsOf(escapedKey)
+            bytes.append(equals)
+
+            return appendEscaped("\(value)", to: &bytes)
+        }
+
+        return true
+    }
+
+    /**
+        Appends the percent-escaped UTF-8 encoding of the string.
+
+        - parameter string: The string to escape.
+        - parameter bytes:  The buffer to append to.
+
+        - returns: `false` if the string contains an unpaired UTF-16 surrogate, `true` otherwise.
+    */
+    static func appendEscaped(string: String, inout to bytes: [UInt8]) -> Bool {
+        let units = string.utf16
+        var index = units.startIndex
+
+        while index != units.endIndex {
+            let unit = units[index]
+            index = index.successor()
+
+            if unit < 0x80 {
+                let byte = UInt8(unit)
+
+                if allowedBytes[Int(byte)] {
+                    bytes.append(byte)
+                } else {
+                    appendPercentEncoded(byte, to: &bytes)
+                }
+
+                continue
+            }
+
+            let scalar: UInt32
+
+            switch unit {
+            case 0xD800..<0xDC00:
+                guard index != units.endIndex && (0xDC00..<0xE000).contains(units[index]) else { return false }
+
+                scalar = 0x10000 + ((UInt32(unit) - 0xD800) << 10) + (UInt32(units[index]) - 0xDC00)
+                index = index.successor()
+            case 0xDC00..<0xE000:
+                return false
+            default:
+                scalar = UInt32(unit)
+            }
+
+            if scalar < 0x800 {
+                appendPercentEncoded(UInt8(0xC0 | scalar >> 6), to: &bytes)
+                appendPercentEncoded(UInt8(0x80 | scalar & 0x3F), to: &bytes)
+            } else if scalar < 0x10000 {
+                appendPercentEncoded(UInt8(0xE0 | scalar >> 12), to: &bytes)
+                appendPercentEncoded(UInt8(0x80 | scalar >> 6 & 0x3F), to: &bytes)
+                appendPercentEncoded(UInt8(0x80 | scalar & 0x3F), to: &bytes)
+            } else {
+                appendPercentEncoded(UInt8(0xF0 | scalar >> 18), to: &bytes)
+                appendPercentEncoded(UInt8(0x80 | scalar >> 12 & 0x3F), to: &bytes)
+                appendPercentEncoded(UInt8(0x80 | scalar >> 6 & 0x3F), to: &bytes)
+                appendPercentEncoded(UInt8(0x80 | scalar & 0x3F), to: &bytes)
+            }
+        }
+
+        return true
+    }
+
+    private static func appendPercentEncoded(byte: UInt8, inout to bytes: [UInt8]) {
+        bytes.append(UInt8(ascii: "%"))
+        bytes.append(hexDigits[Int(byte >> 4)])
+        bytes.append(hexDigits[Int(byte & 0x0F)])
+    }
+}
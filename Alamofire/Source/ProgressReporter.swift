@@ -0,0 +1,174 @@
+// ProgressReporter.swift
+//
+// Copyright (c) 2014–2015 Alamofire Software Foundation (http://alamofire.org/)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+import Foundation
+
+/**
+    Coalesces the progress of a request into updates delivered on a queue at a bounded rate.
+
+    The session delegate queue only records the byte counts with atomic operations. The first count recorded after an 
+    update schedules the next one, which is delivered once the minimum interval since the previous update has passed, 
+    with every byte counted since then. The `NSProgress` of the request is updated along with each delivery rather 
+    than for every chunk, so observers of it are throttled as well.
+
+    Each update claims the bytes it reports by swapping the reported count atomically, so every byte is reported 
+    once even on a concurrent queue. Updates on a concurrent queue may still run out of order, however; only a serial 
+    queue delivers them, and the `NSProgress` counts, in ascending order.
+*/
+final class ProgressReporter {
+
+    // MARK: - Properties
+
+    let progress: NSProgress
+    let queue: dispatch_queue_t
+    let minimumInterval: NSTimeInterval
+    let minimumByteCount: Int64
+    let closure: ((Int64, Int64, Int64) -> Void)?
+
+    // Shared with the session delegate queue, so only accessed atomically
+    private let totalBytes = UnsafeMutablePointer<Int64>.alloc(1)
+    private let totalBytesExpected = UnsafeMutablePointer<Int64>.alloc(1)
+    private let reportedBytes = UnsafeMutablePointer<Int64>.alloc(1)
+    private let nextUpdateTime = UnsafeMutablePointer<Int64>.alloc(1)
+    private let updateScheduled = UnsafeMutablePointer<Int32>.alloc(1)
+
+    // MARK: - Lifecycle
+
+    init(
+        progress: NSProgress,
+        queue: dispatch_queue_t,
+        minimumInterval: NSTimeInterval,
+        minimumByteCount: Int64,
+        closure: ((Int64, Int64, Int64) -> Void)?)
+    {
+        self.progress = progress
+        self.queue = queue
+        self.minimumInterval = max(minimumInterval, 0)
+        self.minimumByteCount = max(minimumByteCount, 0)
+        self.closure = closure
+
+        totalBytes.initialize(0)
+        totalBytesExpected.initialize(NSURLSessionTransferSizeUnknown)
+        reportedBytes.initialize(0)
+        nextUpdateTime.initialize(0)
+        updateScheduled.initialize(0)
+    }
+
+    deinit {
+        totalBytes.dealloc(1)
+        totalBytesExpected.dealloc(1)
+        reportedBytes.dealloc(1)
+        nextUpdateTime.dealloc(1)
+        updateScheduled.dealloc(1)
+    }
+
+    // MARK: - Recording
+
+    /**
+        Records the bytes transferred so far, scheduling an update if none is pending and enough bytes have been 
+        transferred since the previous one.
+
+        - parameter totalBytes:         The total number of bytes transferred.
+        - parameter totalBytesExpected: The total number of bytes expected to be transferred.
+    */
+    func recordTotalBytes(totalBytes: Int64, totalBytesExpected: Int64) {
+        ProgressReporter.store(totalBytesExpected, to: self.totalBytesExpected)
+        ProgressReporter.store(totalBytes, to: self.totalBytes)
+
+        // The final update is not held back by an update already scheduled for later
+        if totalBytes == totalBytesExpected {
+            dispatch_async(queue) { self.deliverUpdate() }
+            return
+        }
+
+        let pendingBytes = totalBytes - ProgressReporter.load(reportedBytes)
+
+        guard pendingBytes > 0 && pendingBytes >= minimumByteCount else { return }
+        guard OSAtomicCompareAndSwap32Barrier(0, 1, updateScheduled) else { return }
+
+        let delay = ProgressReporter.load(nextUpdateTime) - ProgressReporter.now()
+
+        if delay > 0 {
+            let when = dispatch_time(DISPATCH_TIME_NOW, delay)
+            dispatch_after(when, queue) { self.deliverUpdate() }
+        } else {
+            dispatch_async(queue) { self.deliverUpdate() }
+        }
+    }
+
+    /// Delivers the bytes not yet reported once the task has completed, after any pending update.
+    func finish() {
+        dispatch_async(queue) { self.deliverUpdate() }
+    }
+
+    /// Discards the recorded bytes and the pending update state before the request is sent again.
+    func reset() {
+        ProgressReporter.store(0, to: totalBytes)
+        ProgressReporter.store(0, to: reportedBytes)
+        ProgressReporter.store(0, to: nextUpdateTime)
+        OSAtomicCompareAndSwap32Barrier(1, 0, updateScheduled)
+    }
+
+    // MARK: - Private
+
+    private func deliverUpdate() {
+        // Cleared before the counts are read, so bytes recorded after the read schedule another update
+        OSAtomicCompareAndSwap32Barrier(1, 0, updateScheduled)
+
+        var totalBytes: Int64
+        var bytes: Int64
+
+        // Claims the bytes not yet reported, so an update running concurrently cannot report them again
+        repeat {
+            let reportedBytes = ProgressReporter.load(self.reportedBytes)
+            totalBytes = ProgressReporter.load(self.totalBytes)
+            bytes = totalBytes - reportedBytes
+
+            guard bytes > 0 else { return }
+        } while !OSAtomicCompareAndSwap64Barrier(totalBytes - bytes, totalBytes, reportedBytes)
+
+        let totalBytesExpected = ProgressReporter.load(self.totalBytesExpected)
+
+        ProgressReporter.store(ProgressReporter.now() + Int64(minimumInterval * Double(NSEC_PER_SEC)), to: nextUpdateTime)
+
+        progress.totalUnitCount = totalBytesExpected
+        progress.completedUnitCount = totalBytes
+
+        closure?(bytes, totalBytes, totalBytesExpected)
+    }
+
+    private static func now() -> Int64 {
+        return Int64(CFAbsoluteTimeGetCurrent() * Double(NSEC_PER_SEC))
+    }
+
+    private static func load(pointer: UnsafeMutablePointer<Int64>) -> Int64 {
+        return OSAtomicAdd64Barrier(0, pointer)
+    }
+
+    private static func store(value: Int64, to pointer: UnsafeMutablePointer<Int64>) {
+        var oldValue: Int64
+
+        repeat {
+            oldValue = pointer.memory
+        } while !OSAtomicCompareAndSwap64Barrier(oldValue, value, pointer)
+    }
+}
@@ -43,11 +43,50 @@ public class Request {
     public var request: NSURLRequest? { return task.originalRequest }
 
     /// The response received from the server, if any.
-    public var response: NSHTTPURLResponse? { return task.response as? NSHTTPURLResponse }
+    public var response: NSHTTPURLResponse? {
+        return delegate.cachedResponse?.response ?? task.response as? NSHTTPURLResponse
+    }
 
     /// The progress of the request lifecycle.
     public var progress: NSProgress { return delegate.progress }
 
+    /// The number of times the request was retried by the `RetryPolicy` of its `Manager`.
+    public var retryCount: Int { return delegate.retryCount }
+
+    /**
+        The priority class of the request in the `RequestScheduler` of its `Manager`. `.Interactive` by default.
+
+        Changing the priority of a queued request moves it to the queue of the new priority class. It has no effect once 
+        the request has started.
+    */
+    public var priority: RequestPriority {
+        get {
+            return scheduler?.priorityOfDelegate(delegate) ?? delegate.priority
+        }
+        set {
+            if let scheduler = scheduler {
+                scheduler.setPriority(newValue, ofDelegate: delegate)
+            } else {
+                delegate.priority = newValue
+            }
+        }
+    }
+
+    /// The data received from the server as the chunks it arrived in, if any. Only read it once the request has 
+    /// completed, such as from a response handler.
+    public var receivedData: ChunkedData? { return (delegate as? DataTaskDelegate)?.receivedData }
+
+    /// The closure the timeline of every response handler call is reported to, set by the `Manager` creating the 
+    /// request.
+    var metricsSink: ((Request, Timeline) -> Void)?
+
+    /// The executor response serializers run on, set by the `Manager` creating the request. If `nil`, they run on the 
+    /// operation queue of the delegate.
+    var serializationExecutor: SerializationExecutor?
+
+    /// The scheduler the first resume of the request queues it on, set by the `Manager` creating the request.
+    var scheduler: RequestScheduler?
+
     // MARK: - Lifecycle
 
     init(session: NSURLSession, task: NSURLSessionTask) {
@@ -127,6 +166,42 @@ public class Request {
         return self
     }
 
+    /**
+        Coalesces the progress of the request into updates delivered on the specified queue at a bounded rate.
+
+        Updates are delivered at most once per minimum interval, and only once the minimum number of bytes has been 
+        transferred since the previous update, except for the final update. The `progress` of the request is updated 
+        along with each delivery rather than for every chunk the session reports.
+
+        The final update is only guaranteed to run before the response handlers when they are given the same serial 
+        queue. On a concurrent queue, updates may also run out of order, although each byte is reported once.
+
+        - parameter queue:            The queue the updates are delivered on. A serial queue is recommended.
+        - parameter minimumInterval:  The minimum time between two updates. `0.1` seconds by default.
+        - parameter minimumByteCount: The minimum number of bytes transferred between two updates. `0` by default.
+        - parameter closure:          The code to be executed with the bytes transferred since the previous update, the 
+                                      total bytes transferred, and the total bytes expected. `nil` by default.
+
+        - returns: The request.
+    */
+    public func progress(
+        queue queue: dispatch_queue_t,
+        minimumInterval: NSTimeInterval = 0.1,
+        minimumByteCount: Int64 = 0,
+        closure: ((Int64, Int64, Int64) -> Void)? = nil)
+        -> Self
+    {
+        delegate.progressReporter = ProgressReporter(
+            progress: delegate.progress,
+            queue: queue,
+            minimumInterval: minimumInterval,
+            minimumByteCount: minimumByteCount,
+            closure: closure
+        )
+
+        return self
+    }
+
     /**
         Sets a closure to be called periodically during the lifecycle of the request as data is read from the server.
 
@@ -152,20 +227,30 @@ public class Request {
         Suspends the request.
     */
     public func suspend() {
-        task.suspend()
+        if let scheduler = scheduler {
+            scheduler.suspend(delegate)
+        } else {
+            task.suspend()
+        }
     }
 
     /**
         Resumes the request.
     */
     public func resume() {
-        task.resume()
+        if let scheduler = scheduler {
+            scheduler.resume(delegate)
+        } else {
+            delegate.resumeTask()
+        }
     }
 
     /**
         Cancels the request.
     */
     public func cancel() {
+        delegate.isCancelled = true
+
         if let
             downloadDelegate = delegate as? DownloadTaskDelegate,
             downloadTask = downloadDelegate.downloadTask
@@ -178,6 +263,26 @@ public class Request {
         }
     }
 
+    // MARK: - Timeline
+
+    /**
+        Returns the timeline of the request for a response handler starting now.
+
+        - parameter serializationCompletedTime: The time the response serializer of the handler finished.
+
+        - returns: The timeline.
+    */
+    func timelineWithSerializationCompletedTime(serializationCompletedTime: CFAbsoluteTime) -> Timeline {
+        return Timeline(
+            requestStartTime: delegate.requestStartTime,
+            taskResumeTime: delegate.taskResumeTime ?? 0.0,
+            initialResponseTime: delegate.initialResponseTime ?? 0.0,
+            requestCompletedTime: delegate.requestCompletedTime ?? 0.0,
+            serializationCompletedTime: serializationCompletedTime,
+            completionHandlerStartTime: CFAbsoluteTimeGetCurrent()
+        )
+    }
+
     // MARK: - TaskDelegate
 
     /**
@@ -187,35 +292,114 @@ public class Request {
     public class TaskDelegate: NSObject {
 
         /// The serial operation queue used to execute all operations after the task completes.
-        public let queue: NSOperationQueue
+        public var queue: NSOperationQueue { return handlerQueue.operationQueue }
+
+        /// Runs the closures added by Alamofire, one at a time, after the task completes. Accessing `queue` moves 
+        /// them to an operation queue.
+        let handlerQueue: HandlerQueue
+
+        /// The task sending the request. A retry replaces it on the manager queue while the session delegate queue, 
+        /// the scheduler and callers may be reading it, so it is guarded by a mutex.
+        var task: NSURLSessionTask {
+            pthread_mutex_lock(taskMutex)
+            defer { pthread_mutex_unlock(taskMutex) }
+
+            return currentTask
+        }
+
+        private var currentTask: NSURLSessionTask
+        private let taskMutex = UnsafeMutablePointer<pthread_mutex_t>.alloc(1)
 
-        let task: NSURLSessionTask
         let progress: NSProgress
 
+        /// Coalesces updates of `progress` and delivers them on a queue, if set.
+        var progressReporter: ProgressReporter?
+
         var data: NSData? { return nil }
         var error: NSError?
 
+        /// The response from a `ResponseCache` that completes the request in place of the task response, if any.
+        var cachedResponse: CachedResponse?
+
         var credential: NSURLCredential?
 
+        let requestStartTime = CFAbsoluteTimeGetCurrent()
+        var taskResumeTime: CFAbsoluteTime?
+        var initialResponseTime: CFAbsoluteTime?
+        var requestCompletedTime: CFAbsoluteTime?
+
+        /// The group left once the last completion handler dispatched after a serialization executor has returned.
+        var lastCompletionGroup: dispatch_group_t?
+
+        /// Called when the task completes, before the operation queue is resumed. Returns `true` if the request will 
+        /// be retried with a new task, in which case the queue stays suspended.
+        var retryHandler: (NSError? -> Bool)?
+        var retryCount = 0
+        var isCancelled = false
+        /// Whether a retry is scheduled and its task not yet created. Only accessed on the queue of the `Manager`.
+        var isWaitingToRetry = false
+
+        // Only accessed on the queue of the scheduler, if the request has one
+        var priority: RequestPriority = .Interactive
+        var schedulingState: RequestScheduler.State = .Unscheduled
+
+        /// Called once the request has finished, after any retries, before the operation queue is resumed.
+        var requestDidFinish: (() -> Void)?
+
+        /// Whether the request can be sent again with a new task without losing data or repeating side effects.
+        var canRetry: Bool { return false }
+
         init(task: NSURLSessionTask) {
-            self.task = task
+            self.currentTask = task
             self.progress = NSProgress(totalUnitCount: 0)
-            self.queue = {
-                let operationQueue = NSOperationQueue()
-                operationQueue.maxConcurrentOperationCount = 1
-                operationQueue.suspended = true
+            self.handlerQueue = HandlerQueue()
 
-                if #available(OSX 10.10, *) {
-                    operationQueue.qualityOfService = NSQualityOfService.Utility
-                }
-
-                return operationQueue
-            }()
+            pthread_mutex_init(taskMutex, nil)
         }
 
         deinit {
-            queue.cancelAllOperations()
-            queue.suspended = false
+            pthread_mutex_destroy(taskMutex)
+            taskMutex.dealloc(1)
+        }
+
+        /**
+            Resets the state gathered from the completed task and replaces it with the specified one.
+
+            - parameter task: The task sending the request again.
+        */
+        func prepareForRetryWithTask(task: NSURLSessionTask) {
+            pthread_mutex_lock(taskMutex)
+            currentTask = task
+            pthread_mutex_unlock(taskMutex)
+
+            error = nil
+            initialResponseTime = nil
+            requestCompletedTime = nil
+            progress.completedUnitCount = 0
+            progressReporter?.reset()
+        }
+
+        func resumeTask() {
+            if taskResumeTime == nil {
+                taskResumeTime = CFAbsoluteTimeGetCurrent()
+            }
+
+            task.resume()
+        }
+
+        func updateProgressWithTotalBytes(totalBytes: Int64, totalBytesExpected: Int64) {
+            if let progressReporter = progressReporter {
+                progressReporter.recordTotalBytes(totalBytes, totalBytesExpected: totalBytesExpected)
+            } else {
+                progress.totalUnitCount = totalBytesExpected
+                progress.completedUnitCount = totalBytes
+            }
+        }
+
+        func recordInitialResponse() {
+            if initialResponseTime == nil {
+                initialResponseTime = CFAbsoluteTimeGetCurrent()
+            }
         }
 
         // MARK: - NSURLSessionTaskDelegate
@@ -300,9 +484,18 @@ public class Request {
         }
 
         func URLSession(session: NSURLSession, task: NSURLSessionTask, didCompleteWithError error: NSError?) {
+            requestCompletedTime = CFAbsoluteTimeGetCurrent()
+
             if let taskDidCompleteWithError = taskDidCompleteWithError {
+                requestDidFinish?()
+                progressReporter?.finish()
                 taskDidCompleteWithError(session, task, error)
+            } else if retryHandler?(error) ?? false {
+                return
             } else {
+                requestDidFinish?()
+                progressReporter?.finish()
+
                 if let error = error {
                     self.error = error
 
@@ -315,7 +508,7 @@ public class Request {
                     }
                 }
 
-                queue.suspended = false
+                handlerQueue.suspended = false
             }
         }
     }
@@ -326,12 +519,61 @@ public class Request {
         var dataTask: NSURLSessionDataTask? { return task as? NSURLSessionDataTask }
 
         private var totalBytesReceived: Int64 = 0
-        private var mutableData: NSMutableData
+        private var chunkedData = ChunkedData()
+        private let contiguousDataQueue = dispatch_queue_create(nil, DISPATCH_QUEUE_SERIAL)
         override var data: NSData? {
             if dataStream != nil {
                 return nil
+            } else if let cachedResponse = cachedResponse {
+                return cachedResponse.data
             } else {
-                return mutableData
+                // Response handlers may ask for the data on different queues, but it must only be coalesced once
+                var data: NSData!
+                dispatch_sync(contiguousDataQueue) {
+                    data = self.chunkedData.contiguousData()
+                }
+
+                return data
+            }
+        }
+
+        // Streamed data was already handed out, so sending the request again would deliver it twice
+        override var canRetry: Bool { return dataStream == nil && cachedResponse == nil }
+
+        override func prepareForRetryWithTask(task: NSURLSessionTask) {
+            super.prepareForRetryWithTask(task)
+
+            dispatch_sync(contiguousDataQueue) {
+                self.chunkedData = ChunkedData()
+            }
+
+            totalBytesReceived = 0
+            expectedContentLength = nil
+        }
+
+        /// The data received so far as the chunks it arrived in, or `nil` if the data is being streamed.
+        var receivedData: ChunkedData? {
+            return dataStream != nil ? nil : chunkedData
+        }
+
+        /**
+            Delivers the body of the cached response the way the network delivers a body: to the stream closure if 
+            one is set, and into the received data otherwise.
+
+            Called on the operation queue before any response handler, once `cachedResponse` is set.
+        */
+        func replayCachedResponse() {
+            guard let data = cachedResponse?.data else { return }
+
+            if let dataStream = dataStream {
+                if data.length > 0 {
+                    dataStream(data: data)
+                }
+            } else {
+                dispatch_sync(contiguousDataQueue) {
+                    self.chunkedData = ChunkedData()
+                    self.chunkedData.appendData(data)
+                }
             }
         }
 
@@ -339,11 +581,6 @@ public class Request {
         private var dataProgress: ((bytesReceived: Int64, totalBytesReceived: Int64, totalBytesExpectedToReceive: Int64) -> Void)?
         private var dataStream: ((data: NSData) -> Void)?
 
-        override init(task: NSURLSessionTask) {
-            mutableData = NSMutableData()
-            super.init(task: task)
-        }
-
         // MARK: - NSURLSessionDataDelegate
 
         // MARK: Override Closures
@@ -363,6 +600,7 @@ public class Request {
         {
             var disposition: NSURLSessionResponseDisposition = .Allow
 
+            recordInitialResponse()
             expectedContentLength = response.expectedContentLength
 
             if let dataTaskDidReceiveResponse = dataTaskDidReceiveResponse {
@@ -381,20 +619,21 @@ public class Request {
         }
 
         func URLSession(session: NSURLSession, dataTask: NSURLSessionDataTask, didReceiveData data: NSData) {
+            recordInitialResponse()
+
             if let dataTaskDidReceiveData = dataTaskDidReceiveData {
                 dataTaskDidReceiveData(session, dataTask, data)
             } else {
                 if let dataStream = dataStream {
                     dataStream(data: data)
                 } else {
-                    mutableData.appendData(data)
+                    chunkedData.appendData(data)
                 }
 
                 totalBytesReceived += data.length
                 let totalBytesExpected = dataTask.response?.expectedContentLength ?? NSURLSessionTransferSizeUnknown
 
-                progress.totalUnitCount = totalBytesExpected
-                progress.completedUnitCount = totalBytesReceived
+                updateProgressWithTotalBytes(totalBytesReceived, totalBytesExpected: totalBytesExpected)
 
                 dataProgress?(
                     bytesReceived: Int64(data.length),
@@ -0,0 +1,271 @@
+// RequestScheduler.swift
+//
+// Copyright (c) 2014–2015 Alamofire Software Foundation (http://alamofire.org/)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+import Foundation
+
+/**
+    The priority classes of the `RequestScheduler`.
+
+    - `Interactive`: For requests the user is waiting on, such as sending a message. The default.
+    - `Prefetch`:    For requests whose results will likely be needed soon, such as history pages.
+    - `Background`:  For bulk or maintenance requests no one is waiting on.
+*/
+public enum RequestPriority: Int {
+    case Background
+    case Prefetch
+    case Interactive
+}
+
+// MARK: -
+
+/**
+    Limits how many requests of a `Manager` run at once, overall and per host, and decides which queued request runs 
+    next.
+
+    Resuming a request for the first time queues it. A queued request starts as soon as both limits allow it and no 
+    request of a higher priority is waiting for the same room. Within a priority class, hosts take turns, so that a 
+    host with a long queue does not hold back the others, and each host starts its requests in the order they were 
+    queued. A request stays counted until it has finished, including any retries.
+
+    Cancelling a queued request does not search the queues: its task is cancelled, and its entry is skipped when it 
+    reaches the front.
+*/
+public final class RequestScheduler {
+
+    // MARK: - Helper Types
+
+    enum State {
+        case Unscheduled, Queued, Running, Finished
+    }
+
+    /// A first-in, first-out queue that removes from the front without moving the remaining elements.
+    private struct Queue {
+        private var elements: [Request.TaskDelegate] = []
+        private var head = 0
+
+        var isEmpty: Bool { return head == elements.count }
+
+        mutating func append(delegate: Request.TaskDelegate) {
+            elements.append(delegate)
+        }
+
+        mutating func removeFirst() -> Request.TaskDelegate {
+            let delegate = elements[head]
+            head += 1
+
+            if head == elements.count {
+                elements.removeAll(keepCapacity: true)
+                head = 0
+            } else if head >= 64 && head * 2 >= elements.count {
+                elements.removeFirst(head)
+                head = 0
+            }
+
+            return delegate
+        }
+    }
+
+    // MARK: - Properties
+
+    /// The maximum number of requests running at once to a single host.
+    public let maximumConcurrentRequestsPerHost: Int
+
+    /// The maximum number of requests running at once across all hosts.
+    public let maximumConcurrentRequests: Int
+
+    private let queue = dispatch_queue_create("com.alamofire.request-scheduler", DISPATCH_QUEUE_SERIAL)
+
+    private var runningCount = 0
+    private var runningCountsByHost: [String: Int] = [:]
+
+    // For every priority, from the highest: the queue of each host and the hosts in turn order
+    private var queuesByHost: [[String: Queue]]
+    private var hostTurns: [[String]]
+
+    // MARK: - Lifecycle
+
+    /**
+        Initializes the `RequestScheduler` instance with the specified concurrency limits.
+
+        - parameter maximumConcurrentRequestsPerHost: The maximum number of requests running at once to a single host. 
+                                                      `4` by default.
+        - parameter maximumConcurrentRequests:        The maximum number of requests running at once. `16` by default.
+
+        - returns: The new `RequestScheduler` instance.
+    */
+    public init(maximumConcurrentRequestsPerHost: Int = 4, maximumConcurrentRequests: Int = 16) {
+        self.maximumConcurrentRequestsPerHost = max(maximumConcurrentRequestsPerHost, 1)
+        self.maximumConcurrentRequests = max(maximumConcurrentRequests, 1)
+
+        let priorityCount = RequestPriority.Interactive.rawValue + 1
+        self.queuesByHost = [[String: Queue]](count: priorityCount, repeatedValue: [:])
+        self.hostTurns = [[String]](count: priorityCount, repeatedValue: [])
+    }
+
+    // MARK: - Scheduling
+
+    // Requests are tracked by their delegates, which the session keeps alive until the task completes, so that a 
+    // request no one holds on to still gives back its room. The priority and scheduling state of a delegate are only 
+    // accessed on the queue of the scheduler.
+
+    func resume(delegate: Request.TaskDelegate) {
+        dispatch_async(queue) {
+            switch delegate.schedulingState {
+            case .Unscheduled:
+                delegate.schedulingState = .Queued
+                self.append(delegate)
+                self.startRequests()
+            case .Queued:
+                break
+            case .Running, .Finished:
+                delegate.resumeTask()
+            }
+        }
+    }
+
+    func suspend(delegate: Request.TaskDelegate) {
+        // On the queue, so that it cannot overtake an earlier call to `resume(_:)`
+        dispatch_async(queue) {
+            delegate.task.suspend()
+        }
+    }
+
+    func priorityOfDelegate(delegate: Request.TaskDelegate) -> RequestPriority {
+        var priority = RequestPriority.Interactive
+        dispatch_sync(queue) { priority = delegate.priority }
+
+        return priority
+    }
+
+    func setPriority(priority: RequestPriority, ofDelegate delegate: Request.TaskDelegate) {
+        dispatch_async(queue) {
+            delegate.priority = priority
+
+            guard delegate.schedulingState == .Queued else { return }
+
+            // The entry at the previous priority is skipped once this one has started the request
+            self.append(delegate)
+            self.startRequests()
+        }
+    }
+
+    func didFinish(delegate: Request.TaskDelegate) {
+        dispatch_async(queue) {
+            let state = delegate.schedulingState
+            delegate.schedulingState = .Finished
+
+            guard state == .Running else { return }
+
+            let host = RequestScheduler.hostForDelegate(delegate)
+            self.runningCount -= 1
+            self.runningCountsByHost[host] = (self.runningCountsByHost[host] ?? 1) - 1
+
+            if self.runningCountsByHost[host] == 0 {
+                self.runningCountsByHost.removeValueForKey(host)
+            }
+
+            self.startRequests()
+        }
+    }
+
+    // MARK: - Private
+
+    private static func hostForDelegate(delegate: Request.TaskDelegate) -> String {
+        return delegate.task.originalRequest?.URL?.host ?? ""
+    }
+
+    private static func levelForPriority(priority: RequestPriority) -> Int {
+        return RequestPriority.Interactive.rawValue - priority.rawValue
+    }
+
+    private func append(delegate: Request.TaskDelegate) {
+        let level = RequestScheduler.levelForPriority(delegate.priority)
+        let host = RequestScheduler.hostForDelegate(delegate)
+
+        if queuesByHost[level][host] == nil {
+            queuesByHost[level][host] = Queue()
+            hostTurns[level].append(host)
+        }
+
+        queuesByHost[level][host]?.append(delegate)
+    }
+
+    private func startRequests() {
+        while runningCount < maximumConcurrentRequests {
+            guard let delegate = nextDelegate() else { break }
+
+            let host = RequestScheduler.hostForDelegate(delegate)
+
+            delegate.schedulingState = .Running
+            runningCount += 1
+            runningCountsByHost[host] = (runningCountsByHost[host] ?? 0) + 1
+
+            delegate.resumeTask()
+        }
+    }
+
+    private func nextDelegate() -> Request.TaskDelegate? {
+        // Levels go from the highest priority down. A host at its limit is passed over at every level, which lets a 
+        // lower priority use room that no higher priority request can.
+        for level in queuesByHost.indices {
+            var turn = 0
+
+            while turn < hostTurns[level].count {
+                let host = hostTurns[level][turn]
+
+                if (runningCountsByHost[host] ?? 0) >= maximumConcurrentRequestsPerHost {
+                    turn += 1
+                    continue
+                }
+
+                var hostQueue = queuesByHost[level][host]!
+                queuesByHost[level][host] = nil
+
+                while !hostQueue.isEmpty {
+                    let delegate = hostQueue.removeFirst()
+
+                    guard isStartable(delegate, level: level) else { continue }
+
+                    // The host moves to the back of the turn order, keeping what is left of its queue
+                    hostTurns[level].removeAtIndex(turn)
+
+                    if !hostQueue.isEmpty {
+                        queuesByHost[level][host] = hostQueue
+                        hostTurns[level].append(host)
+                    }
+
+                    return delegate
+                }
+
+                hostTurns[level].removeAtIndex(turn)
+            }
+        }
+
+        return nil
+    }
+
+    private func isStartable(delegate: Request.TaskDelegate, level: Int) -> Bool {
+        return delegate.schedulingState == .Queued &&
+            RequestScheduler.levelForPriority(delegate.priority) == level &&
+            delegate.task.state == .Suspended
+    }
+}
@@ -0,0 +1,578 @@
+// ResponseCache.swift
+//
+// Copyright (c) 2014–2015 Alamofire Software Foundation (http://alamofire.org/)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+import Foundation
+
+/**
+    A response stored in a `ResponseCache`, along with what is needed to decide whether it can be used as is.
+*/
+public struct CachedResponse {
+    /// The response as it was stored, with any headers updated by later revalidations.
+    public let response: NSHTTPURLResponse
+
+    /// The response data.
+    public let data: NSData
+
+    /// The date the response was stored or last revalidated.
+    public let storedDate: NSDate
+
+    /// The date after which the response must be revalidated before it is used.
+    public let expirationDate: NSDate
+
+    /// Returns `true` if the response can be used without revalidation, `false` otherwise.
+    public var isFresh: Bool { return expirationDate.timeIntervalSinceNow > 0 }
+
+    /// The `ETag` header value of the response, if any.
+    public var entityTag: String? { return HTTPHeaders.valueForField("ETag", inHeaders: response.allHeaderFields) }
+
+    /// The `Last-Modified` header value of the response, if any.
+    public var lastModified: String? {
+        return HTTPHeaders.valueForField("Last-Modified", inHeaders: response.allHeaderFields)
+    }
+}
+
+// MARK: -
+
+/**
+    An on-disk cache of `GET` responses with a size budget and HTTP validators.
+
+    Each response body is stored in its own file and read back memory-mapped. The index describing the entries is a 
+    binary property list, parsed into a dictionary when the cache is opened and written back shortly after it 
+    changes. When the bodies exceed the size limit, the least recently used entries are evicted.
+
+    Freshness follows the `Cache-Control` `max-age`, `no-cache` and `no-store` directives and the `Expires` header. 
+    Stale responses are revalidated with `If-None-Match` and `If-Modified-Since` when they have an `ETag` or 
+    `Last-Modified` header. Assign the cache to `Manager.responseCache` to use it for requests.
+
+    The cache may be shared by the users of a device, so requests carrying an `Authorization` header and responses 
+    marked `private` are never stored. A response is only used for a request with the same values of the request 
+    headers its `Vary` header lists.
+*/
+public final class ResponseCache {
+
+    // MARK: - Helper Types
+
+    /**
+        Used to specify how a `Manager` handles stale cached responses.
+
+        - `Revalidate`:           Revalidates the stale response with the server before the request completes.
+
+        - `StaleWhileRevalidate`: Completes the request with the stale response right away and revalidates it in the 
+                                  background, so that later requests get the refreshed response.
+    */
+    public enum Mode {
+        case Revalidate
+        case StaleWhileRevalidate
+    }
+
+    private struct IndexKeys {
+        static let Key = "key"
+        static let URL = "url"
+        static let FileName = "file"
+        static let Size = "size"
+        static let StatusCode = "status"
+        static let Headers = "headers"
+        static let StoredDate = "stored"
+        static let ExpirationDate = "expires"
+        static let AccessDate = "accessed"
+        static let VaryingHeaders = "vary"
+    }
+
+    // MARK: - Properties
+
+    /// The directory containing the index and the response bodies.
+    public let directoryURL: NSURL
+
+    /// The maximum total size in bytes of the stored response bodies.
+    public let sizeLimit: UInt64
+
+    /// The total size in bytes of the stored response bodies.
+    public var size: UInt64 {
+        var size: UInt64 = 0
+        dispatch_sync(queue) { size = self.totalSize }
+        return size
+    }
+
+    private let queue = dispatch_queue_create("com.alamofire.response-cache", DISPATCH_QUEUE_SERIAL)
+    private let fileManager = NSFileManager()
+    private var entries: [String: [String: AnyObject]] = [:]
+    private var totalSize: UInt64 = 0
+    private var indexWriteScheduled = false
+
+    private var indexURL: NSURL { return directoryURL.URLByAppendingPathComponent("index.plist") }
+
+    // MARK: - Lifecycle
+
+    /**
+        Initializes the `ResponseCache` instance with the specified directory and size limit, loading any entries 
+        already stored there.
+
+        - parameter directoryURL: The directory in which to store the cache. It is created if needed.
+        - parameter sizeLimit:    The maximum total size in bytes of the stored response bodies. 50 MB by default.
+
+        - returns: The new `ResponseCache` instance.
+    */
+    public init(directoryURL: NSURL, sizeLimit: UInt64 = 50 * 1024 * 1024) {
+        self.directoryURL = directoryURL
+        self.sizeLimit = sizeLimit
+
+        _ = try? fileManager.createDirectoryAtURL(directoryURL, withIntermediateDirectories: true, attributes: nil)
+
+        if let
+            data = try? NSData(contentsOfURL: indexURL, options: .DataReadingMappedIfSafe),
+            index = try? NSPropertyListSerialization.propertyListWithData(data, options: .Immutable, format: nil),
+            entries = index as? [String: [String: AnyObject]]
+        {
+            self.entries = entries
+            self.totalSize = entries.values.reduce(0) { $0 + (($1[IndexKeys.Size] as? NSNumber)?.unsignedLongLongValue ?? 0) }
+        }
+    }
+
+    // MARK: - Lookup
+
+    /**
+        Returns the stored response for the request, whether or not it is fresh.
+
+        - parameter request: The request.
+
+        - returns: The cached response, or `nil` if there is none for the request.
+    */
+    public func cachedResponseForRequest(request: NSURLRequest) -> CachedResponse? {
+        var cachedResponse: CachedResponse?
+        dispatch_sync(queue) { cachedResponse = self.loadCachedResponseForRequest(request) }
+
+        return cachedResponse
+    }
+
+    /**
+        Returns the stored response for the request with empty data, using only the index kept in memory.
+
+        This lets a caller decide whether the response is fresh, or add its validators to a request, without reading 
+        the body from disk.
+
+        - parameter request: The request.
+
+        - returns: The cached response without its data, or `nil` if there is none for the request.
+    */
+    func cachedResponseHeadForRequest(request: NSURLRequest) -> CachedResponse? {
+        guard let key = ResponseCache.keyForRequest(request) else { return nil }
+
+        var cachedResponse: CachedResponse?
+
+        dispatch_sync(queue) {
+            guard let entry = self.entries[key] where ResponseCache.entry(entry, matchesVaryingHeadersOfRequest: request) else {
+                return
+            }
+
+            cachedResponse = self.cachedResponseForEntry(entry, data: NSData())
+        }
+
+        return cachedResponse
+    }
+
+    /**
+        Reads the stored response for the request from disk on the queue of the cache, then calls the completion 
+        handler on that queue.
+
+        - parameter request:           The request.
+        - parameter completionHandler: The code to be executed with the cached response, or `nil` if there is none 
+                                       for the request.
+    */
+    func cachedResponseForRequest(request: NSURLRequest, completionHandler: CachedResponse? -> Void) {
+        dispatch_async(queue) {
+            completionHandler(self.loadCachedResponseForRequest(request))
+        }
+    }
+
+    // Must be called on the queue of the cache
+    private func loadCachedResponseForRequest(request: NSURLRequest) -> CachedResponse? {
+        guard let
+            key = ResponseCache.keyForRequest(request),
+            entry = entries[key] where ResponseCache.entry(entry, matchesVaryingHeadersOfRequest: request) else
+        {
+            return nil
+        }
+
+        guard let
+            fileName = entry[IndexKeys.FileName] as? String,
+            data = try? NSData(contentsOfURL: bodyURL(fileName), options: .DataReadingMappedIfSafe),
+            cachedResponse = cachedResponseForEntry(entry, data: data) else
+        {
+            removeEntryForKey(key)
+            return nil
+        }
+
+        var accessedEntry = entry
+        accessedEntry[IndexKeys.AccessDate] = NSDate()
+        entries[key] = accessedEntry
+        scheduleIndexWrite()
+
+        return cachedResponse
+    }
+
+    /**
+        Adds the validators of the cached response to the request, so that the server can answer `304 Not Modified` 
+        if the response is still valid.
+
+        - parameter request:        The request to modify.
+        - parameter cachedResponse: The cached response for the request.
+    */
+    public func addValidatorsToRequest(request: NSMutableURLRequest, cachedResponse: CachedResponse) {
+        if let entityTag = cachedResponse.entityTag {
+            request.setValue(entityTag, forHTTPHeaderField: "If-None-Match")
+        }
+
+        if let lastModified = cachedResponse.lastModified {
+            request.setValue(lastModified, forHTTPHeaderField: "If-Modified-Since")
+        }
+    }
+
+    // MARK: - Storage
+
+    /**
+        Stores the response for the request if it is cacheable, evicting the least recently used responses when the 
+        size limit is exceeded.
+
+        Only successful `GET` responses that are not marked `no-store` or `private`, do not vary on every request 
+        header and fit in the size limit are stored, and only for requests without an `Authorization` header. The 
+        `Content-Encoding` and `Content-Length` headers are not stored, since they describe the body as it was 
+        transferred rather than the decoded data that is.
+
+        - parameter response: The response.
+        - parameter data:     The response data.
+        - parameter request:  The request the response is for.
+
+        - returns: The stored response, or `nil` if the response is not cacheable.
+    */
+    public func storeResponse(response: NSHTTPURLResponse, data: NSData, forRequest request: NSURLRequest) -> CachedResponse? {
+        let headers = response.allHeaderFields
+        let directives = ResponseCache.cacheControlDirectives(headers)
+
+        guard let
+            key = ResponseCache.keyForRequest(request),
+            URL = response.URL,
+            varyingHeaders = ResponseCache.varyingHeadersOfRequest(request, forHeaders: headers)
+            where response.statusCode == 200 &&
+                UInt64(data.length) <= sizeLimit &&
+                !directives.keys.contains("no-store") &&
+                !directives.keys.contains("private") else
+        {
+            return nil
+        }
+
+        var storedHeaders = ResponseCache.stringHeaders(headers)
+
+        for field in storedHeaders.keys where ["content-encoding", "content-length"].contains(field.lowercaseString) {
+            storedHeaders.removeValueForKey(field)
+        }
+
+        let storedDate = NSDate()
+        let fileName = ResponseCache.fileNameForKey(key)
+        let entry: [String: AnyObject] = [
+            IndexKeys.Key: key,
+            IndexKeys.URL: URL.absoluteString,
+            IndexKeys.FileName: fileName,
+            IndexKeys.Size: NSNumber(unsignedLongLong: UInt64(data.length)),
+            IndexKeys.StatusCode: response.statusCode,
+            IndexKeys.Headers: storedHeaders,
+            IndexKeys.StoredDate: storedDate,
+            IndexKeys.ExpirationDate: ResponseCache.expirationDateForHeaders(headers, storedDate: storedDate),
+            IndexKeys.AccessDate: storedDate,
+            IndexKeys.VaryingHeaders: varyingHeaders
+        ]
+
+        var cachedResponse: CachedResponse?
+
+        dispatch_sync(queue) {
+            self.removeEntryForKey(key)
+
+            guard data.writeToURL(self.bodyURL(fileName), atomically: true) else { return }
+
+            self.entries[key] = entry
+            self.totalSize += UInt64(data.length)
+            self.evictEntriesIfNeeded()
+            self.scheduleIndexWrite()
+
+            cachedResponse = self.cachedResponseForEntry(entry, data: data)
+        }
+
+        return cachedResponse
+    }
+
+    /**
+        Refreshes the stored response for the request after the server answered a revalidation with 
+        `304 Not Modified`, merging in the headers of that answer.
+
+        - parameter response: The `304 Not Modified` response.
+        - parameter request:  The request the response is for.
+
+        - returns: The refreshed response, or `nil` if there is no stored response for the request.
+    */
+    public func refreshResponse(response: NSHTTPURLResponse, forRequest request: NSURLRequest) -> CachedResponse? {
+        guard let key = ResponseCache.keyForRequest(request) else { return nil }
+
+        var cachedResponse: CachedResponse?
+
+        dispatch_sync(queue) {
+            guard var entry = self.entries[key], var headers = entry[IndexKeys.Headers] as? [String: String] else {
+                return
+            }
+
+            for (field, value) in ResponseCache.stringHeaders(response.allHeaderFields) {
+                // The stored body still determines these
+                if ["content-length", "content-encoding", "content-type"].contains(field.lowercaseString) {
+                    continue
+                }
+
+                for existingField in headers.keys where existingField.lowercaseString == field.lowercaseString {
+                    headers.removeValueForKey(existingField)
+                }
+
+                headers[field] = value
+            }
+
+            let storedDate = NSDate()
+            entry[IndexKeys.Headers] = headers
+            entry[IndexKeys.StoredDate] = storedDate
+            entry[IndexKeys.ExpirationDate] = ResponseCache.expirationDateForHeaders(headers, storedDate: storedDate)
+            entry[IndexKeys.AccessDate] = storedDate
+
+            guard let
+                fileName = entry[IndexKeys.FileName] as? String,
+                data = try? NSData(contentsOfURL: self.bodyURL(fileName), options: .DataReadingMappedIfSafe) else
+            {
+                self.removeEntryForKey(key)
+                return
+            }
+
+            self.entries[key] = entry
+            self.scheduleIndexWrite()
+
+            cachedResponse = self.cachedResponseForEntry(entry, data: data)
+        }
+
+        return cachedResponse
+    }
+
+    /**
+        Removes the stored response for the request, if any.
+
+        - parameter request: The request.
+    */
+    public func removeCachedResponseForRequest(request: NSURLRequest) {
+        guard let key = ResponseCache.keyForRequest(request) else { return }
+
+        dispatch_sync(queue) {
+            self.removeEntryForKey(key)
+            self.scheduleIndexWrite()
+        }
+    }
+
+    /**
+        Removes all stored responses.
+    */
+    public func removeAllCachedResponses() {
+        dispatch_sync(queue) {
+            for key in Array(self.entries.keys) {
+                self.removeEntryForKey(key)
+            }
+
+            self.writeIndex()
+        }
+    }
+
+    // MARK: - Private - Entries
+
+    private func bodyURL(fileName: String) -> NSURL {
+        return directoryURL.URLByAppendingPathComponent(fileName)
+    }
+
+    private func cachedResponseForEntry(entry: [String: AnyObject], data: NSData) -> CachedResponse? {
+        guard let
+            URLString = entry[IndexKeys.URL] as? String,
+            URL = NSURL(string: URLString),
+            statusCode = entry[IndexKeys.StatusCode] as? Int,
+            headers = entry[IndexKeys.Headers] as? [String: String],
+            storedDate = entry[IndexKeys.StoredDate] as? NSDate,
+            expirationDate = entry[IndexKeys.ExpirationDate] as? NSDate,
+            response = NSHTTPURLResponse(URL: URL, statusCode: statusCode, HTTPVersion: "HTTP/1.1", headerFields: headers) else
+        {
+            return nil
+        }
+
+        return CachedResponse(response: response, data: data, storedDate: storedDate, expirationDate: expirationDate)
+    }
+
+    private func removeEntryForKey(key: String) {
+        guard let entry = entries.removeValueForKey(key) else { return }
+
+        if let fileName = entry[IndexKeys.FileName] as? String {
+            _ = try? fileManager.removeItemAtURL(bodyURL(fileName))
+        }
+
+        totalSize -= min(totalSize, (entry[IndexKeys.Size] as? NSNumber)?.unsignedLongLongValue ?? 0)
+    }
+
+    private func evictEntriesIfNeeded() {
+        guard totalSize > sizeLimit else { return }
+
+        let keysByAccessDate = entries.sort { first, second in
+            let firstDate = first.1[IndexKeys.AccessDate] as? NSDate ?? NSDate.distantPast()
+            let secondDate = second.1[IndexKeys.AccessDate] as? NSDate ?? NSDate.distantPast()
+
+            return firstDate.compare(secondDate) == .OrderedAscending
+        }.map { $0.0 }
+
+        for key in keysByAccessDate where totalSize > sizeLimit {
+            removeEntryForKey(key)
+        }
+    }
+
+    // MARK: - Private - Index
+
+    private func scheduleIndexWrite() {
+        guard !indexWriteScheduled else { return }
+
+        indexWriteScheduled = true
+
+        // Changes made in quick succession, such as the accesses of a screen full of requests, share one write
+        let delay = dispatch_time(DISPATCH_TIME_NOW, Int64(NSEC_PER_SEC))
+        dispatch_after(delay, queue) { self.writeIndex() }
+    }
+
+    private func writeIndex() {
+        indexWriteScheduled = false
+
+        if let data = try? NSPropertyListSerialization.dataWithPropertyList(entries, format: .BinaryFormat_v1_0, options: 0) {
+            data.writeToURL(indexURL, atomically: true)
+        }
+    }
+
+    // MARK: - Private - HTTP
+
+    private static func keyForRequest(request: NSURLRequest) -> String? {
+        guard let
+            URLString = request.URL?.absoluteString
+            where (request.HTTPMethod ?? "GET") == Method.GET.rawValue &&
+                request.valueForHTTPHeaderField("Range") == nil &&
+                request.valueForHTTPHeaderField("Authorization") == nil else
+        {
+            return nil
+        }
+
+        return URLString
+    }
+
+    /// Returns the values of the request headers listed by the `Vary` header of the response, keyed by lowercased 
+    /// field name, or `nil` if the response varies on `*` and can never be reused.
+    private static func varyingHeadersOfRequest(request: NSURLRequest, forHeaders headers: [NSObject: AnyObject]) -> [String: String]? {
+        var varyingHeaders: [String: String] = [:]
+
+        guard let vary = HTTPHeaders.valueForField("Vary", inHeaders: headers) else { return varyingHeaders }
+
+        for component in vary.componentsSeparatedByString(",") {
+            let field = component.stringByTrimmingCharactersInSet(.whitespaceCharacterSet()).lowercaseString
+
+            if field == "*" {
+                return nil
+            } else if !field.isEmpty {
+                varyingHeaders[field] = request.valueForHTTPHeaderField(field) ?? ""
+            }
+        }
+
+        return varyingHeaders
+    }
+
+    private static func entry(entry: [String: AnyObject], matchesVaryingHeadersOfRequest request: NSURLRequest) -> Bool {
+        guard let varyingHeaders = entry[IndexKeys.VaryingHeaders] as? [String: String] else { return true }
+
+        for (field, value) in varyingHeaders where (request.valueForHTTPHeaderField(field) ?? "") != value {
+            return false
+        }
+
+        return true
+    }
+
+    private static func fileNameForKey(key: String) -> String {
+        // 64-bit FNV-1a
+        var hash: UInt64 = 0xcbf29ce484222325
+
+        for byte in key.utf8 {
+            hash = (hash ^ UInt64(byte)) &* 0x100000001b3
+        }
+
+        return String(format: "%016llx", hash)
+    }
+
+    private static func stringHeaders(headers: [NSObject: AnyObject]) -> [String: String] {
+        var stringHeaders: [String: String] = [:]
+
+        for (field, value) in headers {
+            if let field = field as? String, value = value as? String {
+                stringHeaders[field] = value
+            }
+        }
+
+        return stringHeaders
+    }
+
+    private static func cacheControlDirectives(headers: [NSObject: AnyObject]) -> [String: String] {
+        var directives: [String: String] = [:]
+
+        guard let cacheControl = HTTPHeaders.valueForField("Cache-Control", inHeaders: headers) else { return directives }
+
+        for directive in cacheControl.componentsSeparatedByString(",") {
+            let components = directive.componentsSeparatedByString("=")
+            let name = components[0].stringByTrimmingCharactersInSet(.whitespaceCharacterSet()).lowercaseString
+            let value = components.count > 1 ? components[1].stringByTrimmingCharactersInSet(.whitespaceCharacterSet()) : ""
+
+            directives[name] = value
+        }
+
+        return directives
+    }
+
+    private static func expirationDateForHeaders(headers: [NSObject: AnyObject], storedDate: NSDate) -> NSDate {
+        let directives = cacheControlDirectives(headers)
+
+        if directives.keys.contains("no-cache") {
+            return storedDate
+        } else if let maxAge = directives["max-age"].flatMap({ Double($0) }) {
+            return storedDate.dateByAddingTimeInterval(maxAge)
+        } else if let
+            expires = HTTPHeaders.valueForField("Expires", inHeaders: headers),
+            expirationDate = HTTPHeaders.dateFormatter.dateFromString(expires)
+        {
+            // Expires is relative to the server's Date header, which protects against clock skew
+            if let
+                date = HTTPHeaders.valueForField("Date", inHeaders: headers),
+                serverDate = HTTPHeaders.dateFormatter.dateFromString(date)
+            {
+                return storedDate.dateByAddingTimeInterval(expirationDate.timeIntervalSinceDate(serverDate))
+            }
+
+            return expirationDate
+        }
+
+        return storedDate
+    }
+}
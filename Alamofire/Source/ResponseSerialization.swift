@@ -86,11 +86,14 @@ extension Request {
         completionHandler: (NSURLRequest?, NSHTTPURLResponse?, NSData?, NSError?) -> Void)
         -> Self
     {
-        delegate.queue.addOperationWithBlock {
-            dispatch_async(queue ?? dispatch_get_main_queue()) {
+        addSerialization(
+            queue: queue,
+            serialization: { },
+            completion: { _, timeline in
                 completionHandler(self.request, self.response, self.delegate.data, self.delegate.error)
+                self.metricsSink?(self, timeline)
             }
-        }
+        )
 
         return self
     }
@@ -111,28 +114,87 @@ extension Request {
         completionHandler: Response<T.SerializedObject, T.ErrorObject> -> Void)
         -> Self
     {
-        delegate.queue.addOperationWithBlock {
-            let result = responseSerializer.serializeResponse(
-                self.request,
-                self.response,
-                self.delegate.data,
-                self.delegate.error
-            )
-
-            dispatch_async(queue ?? dispatch_get_main_queue()) {
+        addSerialization(
+            queue: queue,
+            serialization: {
+                responseSerializer.serializeResponse(
+                    self.request,
+                    self.response,
+                    self.delegate.data,
+                    self.delegate.error
+                )
+            },
+            completion: { result, timeline in
                 let response = Response<T.SerializedObject, T.ErrorObject>(
                     request: self.request,
                     response: self.response,
                     data: self.delegate.data,
-                    result: result
+                    result: result,
+                    timeline: timeline
                 )
 
                 completionHandler(response)
+                self.metricsSink?(self, timeline)
             }
-        }
+        )
 
         return self
     }
+
+    /**
+        Runs the serialization closure once the request has finished, then calls the completion closure with its value 
+        on the queue.
+
+        Without a serialization executor, the serialization runs on the serial operation queue of the delegate. With 
+        one, it runs on the executor, concurrently with the other serializations of the request, and the completion 
+        closure waits for the completion closures added before it.
+
+        - parameter queue:         The queue on which the completion closure is dispatched. The main queue if `nil`.
+        - parameter serialization: The closure serializing the response.
+        - parameter completion:    The closure receiving the serialized value and the timeline of the request.
+    */
+    func addSerialization<T>(
+        queue queue: dispatch_queue_t?,
+        serialization: () -> T,
+        completion: (T, Timeline) -> Void)
+    {
+        let completionQueue = queue ?? dispatch_get_main_queue()
+
+        delegate.handlerQueue.addOperationWithBlock {
+            guard let serializationExecutor = self.serializationExecutor else {
+                let value = serialization()
+                let serializationCompletedTime = CFAbsoluteTimeGetCurrent()
+
+                dispatch_async(completionQueue) {
+                    completion(value, self.timelineWithSerializationCompletedTime(serializationCompletedTime))
+                }
+
+                return
+            }
+
+            // Operations on the delegate queue run one at a time, so the chain of completion groups needs no lock
+            let previousCompletionGroup = self.delegate.lastCompletionGroup
+            let completionGroup = dispatch_group_create()
+            dispatch_group_enter(completionGroup)
+            self.delegate.lastCompletionGroup = completionGroup
+
+            serializationExecutor.execute {
+                let value = serialization()
+                let serializationCompletedTime = CFAbsoluteTimeGetCurrent()
+
+                let complete = {
+                    completion(value, self.timelineWithSerializationCompletedTime(serializationCompletedTime))
+                    dispatch_group_leave(completionGroup)
+                }
+
+                if let previousCompletionGroup = previousCompletionGroup {
+                    dispatch_group_notify(previousCompletionGroup, completionQueue, complete)
+                } else {
+                    dispatch_async(completionQueue, complete)
+                }
+            }
+        }
+    }
 }
 
 // MARK: - Data
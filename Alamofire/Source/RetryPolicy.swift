@@ -0,0 +1,200 @@
+// RetryPolicy.swift
+//
+// Copyright (c) 2014–2015 Alamofire Software Foundation (http://alamofire.org/)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+import Foundation
+
+/**
+    Decides whether and when a failed request is retried.
+
+    Only requests with an idempotent HTTP method are retried, after a transient network error or a retryable status 
+    code. The delay grows exponentially with each retry, with full jitter so that clients failing together do not retry 
+    together, unless the response has a `Retry-After` header. Retries to each host are limited by a budget over a 
+    sliding window, so that an outage does not turn into a retry storm.
+
+    Assign a policy to `Manager.retryPolicy` to retry the data requests of the manager.
+*/
+public final class RetryPolicy {
+
+    // MARK: - Properties
+
+    /// The maximum number of times a request is retried.
+    public let maximumRetryCount: Int
+
+    /// The delay before the first retry, doubled for every following retry.
+    public let baseDelay: NSTimeInterval
+
+    /// The maximum delay before a retry. Requests whose `Retry-After` asks for a longer delay are not retried.
+    public let maximumDelay: NSTimeInterval
+
+    /// The maximum number of retries to a single host within the `hostRetryBudgetInterval`.
+    public let hostRetryBudget: Int
+
+    /// The sliding window over which the `hostRetryBudget` applies.
+    public let hostRetryBudgetInterval: NSTimeInterval
+
+    /// The HTTP methods of the requests that can be retried.
+    public var idempotentMethods: Set<String> = ["GET", "HEAD", "OPTIONS", "PUT", "DELETE", "TRACE"]
+
+    /// The response status codes after which a request is retried.
+    public var retryableStatusCodes: Set<Int> = [408, 429, 500, 502, 503, 504]
+
+    /// The `NSURLErrorDomain` error codes after which a request is retried.
+    public var retryableURLErrorCodes: Set<Int> = [
+        NSURLErrorTimedOut,
+        NSURLErrorCannotFindHost,
+        NSURLErrorCannotConnectToHost,
+        NSURLErrorNetworkConnectionLost,
+        NSURLErrorDNSLookupFailed,
+        NSURLErrorNotConnectedToInternet
+    ]
+
+    private let mutex = UnsafeMutablePointer<pthread_mutex_t>.alloc(1)
+    private var retryTimesByHost: [String: [CFAbsoluteTime]] = [:]
+
+    // MARK: - Lifecycle
+
+    /**
+        Initializes the `RetryPolicy` instance with the specified retry limits and delays.
+
+        - parameter maximumRetryCount:       The maximum number of times a request is retried. `3` by default.
+        - parameter baseDelay:               The delay before the first retry. `0.5` seconds by default.
+        - parameter maximumDelay:            The maximum delay before a retry. `30` seconds by default.
+        - parameter hostRetryBudget:         The maximum number of retries to a host within the budget interval. `10` 
+                                             by default.
+        - parameter hostRetryBudgetInterval: The sliding window of the host retry budget. `60` seconds by default.
+
+        - returns: The new `RetryPolicy` instance.
+    */
+    public init(
+        maximumRetryCount: Int = 3,
+        baseDelay: NSTimeInterval = 0.5,
+        maximumDelay: NSTimeInterval = 30.0,
+        hostRetryBudget: Int = 10,
+        hostRetryBudgetInterval: NSTimeInterval = 60.0)
+    {
+        self.maximumRetryCount = maximumRetryCount
+        self.baseDelay = baseDelay
+        self.maximumDelay = maximumDelay
+        self.hostRetryBudget = hostRetryBudget
+        self.hostRetryBudgetInterval = hostRetryBudgetInterval
+
+        pthread_mutex_init(mutex, nil)
+    }
+
+    deinit {
+        pthread_mutex_destroy(mutex)
+        mutex.dealloc(1)
+    }
+
+    // MARK: - Retrying
+
+    /**
+        Returns whether the outcome of the request is worth retrying, regardless of the retry count and budget.
+
+        - parameter request:  The URL request.
+        - parameter response: The response, if any.
+        - parameter error:    The error, if any.
+
+        - returns: `true` if the request is idempotent and failed transiently, `false` otherwise.
+    */
+    public func isRetryableRequest(request: NSURLRequest, response: NSHTTPURLResponse?, error: NSError?) -> Bool {
+        guard idempotentMethods.contains(request.HTTPMethod ?? "GET") else { return false }
+
+        if let error = error {
+            return error.domain == NSURLErrorDomain && retryableURLErrorCodes.contains(error.code)
+        } else if let response = response {
+            return retryableStatusCodes.contains(response.statusCode)
+        }
+
+        return false
+    }
+
+    /**
+        Returns the delay after which the request should be retried, taking a retry from the budget of its host.
+
+        - parameter request:    The URL request.
+        - parameter response:   The response, if any.
+        - parameter error:      The error, if any.
+        - parameter retryCount: The number of times the request was already retried.
+
+        - returns: The delay, or `nil` if the request should not be retried.
+    */
+    public func retryDelayForRequest(
+        request: NSURLRequest,
+        response: NSHTTPURLResponse?,
+        error: NSError?,
+        retryCount: Int)
+        -> NSTimeInterval?
+    {
+        guard retryCount < maximumRetryCount && isRetryableRequest(request, response: response, error: error) else {
+            return nil
+        }
+
+        let delay: NSTimeInterval
+
+        if let retryAfter = response.flatMap({ RetryPolicy.retryAfterDelayForResponse($0) }) {
+            guard retryAfter <= maximumDelay else { return nil }
+            delay = retryAfter
+        } else {
+            let exponentialDelay = min(baseDelay * pow(2.0, Double(retryCount)), maximumDelay)
+            delay = exponentialDelay * Double(arc4random()) / Double(UInt32.max)
+        }
+
+        guard takeRetryFromBudgetOfHost(request.URL?.host ?? "") else { return nil }
+
+        return delay
+    }
+
+    // MARK: - Private
+
+    private func takeRetryFromBudgetOfHost(host: String) -> Bool {
+        pthread_mutex_lock(mutex)
+        defer { pthread_mutex_unlock(mutex) }
+
+        let now = CFAbsoluteTimeGetCurrent()
+        var retryTimes = (retryTimesByHost[host] ?? []).filter { now - $0 < hostRetryBudgetInterval }
+
+        guard retryTimes.count < hostRetryBudget else {
+            retryTimesByHost[host] = retryTimes
+            return false
+        }
+
+        retryTimes.append(now)
+        retryTimesByHost[host] = retryTimes
+
+        return true
+    }
+
+    private static func retryAfterDelayForResponse(response: NSHTTPURLResponse) -> NSTimeInterval? {
+        guard let retryAfter = HTTPHeaders.valueForField("Retry-After", inHeaders: response.allHeaderFields) else {
+            return nil
+        }
+
+        if let seconds = Double(retryAfter.stringByTrimmingCharactersInSet(.whitespaceCharacterSet())) {
+            return max(seconds, 0.0)
+        } else if let date = HTTPHeaders.dateFormatter.dateFromString(retryAfter) {
+            return max(date.timeIntervalSinceNow, 0.0)
+        }
+
+        return nil
+    }
+}
@@ -0,0 +1,119 @@
+// SerializationExecutor.swift
+//
+// Copyright (c) 2014–2015 Alamofire Software Foundation (http://alamofire.org/)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+import Foundation
+
+/**
+    Runs response serializers on a shared pool of threads rather than on the serial operation queue of each request.
+
+    Serializers of the same request run concurrently, up to the maximum number of concurrent serializations across all 
+    requests using the executor. Their completion handlers are still called in the order they were added to the 
+    request, and the queue of a completion handler only receives the serialized value.
+
+    Assign an executor to `Manager.serializationExecutor` to use it for the requests of the manager.
+*/
+public final class SerializationExecutor {
+
+    // MARK: - Helper Types
+
+    /**
+        Used to specify the quality of service of the serialization threads.
+
+        - `UserInitiated`: For serialization the user is waiting on.
+        - `Default`:       Between `UserInitiated` and `Utility`.
+        - `Utility`:       For serialization of long running requests the user is not actively waiting on.
+        - `Background`:    For serialization of prefetched or maintenance requests.
+    */
+    public enum QualityOfService {
+        case UserInitiated
+        case Default
+        case Utility
+        case Background
+    }
+
+    // MARK: - Properties
+
+    /// A shared executor limited to one concurrent serialization per active processor, with `.Utility` quality of 
+    /// service.
+    public static let sharedExecutor = SerializationExecutor()
+
+    /// The maximum number of serializations run concurrently.
+    public let maximumConcurrentSerializations: Int
+
+    /// The quality of service of the serialization threads.
+    public let qualityOfService: QualityOfService
+
+    private let operationQueue: NSOperationQueue
+
+    // MARK: - Lifecycle
+
+    /**
+        Initializes the `SerializationExecutor` instance with the specified parallelism limit and quality of service.
+
+        - parameter maximumConcurrentSerializations: The maximum number of serializations run concurrently. The number 
+                                                     of active processors by default.
+        - parameter qualityOfService:                The quality of service of the serialization threads. `.Utility` 
+                                                     by default.
+
+        - returns: The new `SerializationExecutor` instance.
+    */
+    public init(
+        maximumConcurrentSerializations: Int = NSProcessInfo.processInfo().activeProcessorCount,
+        qualityOfService: QualityOfService = .Utility)
+    {
+        self.maximumConcurrentSerializations = max(maximumConcurrentSerializations, 1)
+        self.qualityOfService = qualityOfService
+
+        self.operationQueue = {
+            let operationQueue = NSOperationQueue()
+            operationQueue.name = "com.alamofire.serialization"
+            operationQueue.maxConcurrentOperationCount = max(maximumConcurrentSerializations, 1)
+
+            if #available(OSX 10.10, *) {
+                switch qualityOfService {
+                case .UserInitiated:
+                    operationQueue.qualityOfService = .UserInitiated
+                case .Default:
+                    operationQueue.qualityOfService = .Default
+                case .Utility:
+                    operationQueue.qualityOfService = .Utility
+                case .Background:
+                    operationQueue.qualityOfService = .Background
+                }
+            }
+
+            return operationQueue
+        }()
+    }
+
+    // MARK: - Execution
+
+    /**
+        Runs the closure on one of the serialization threads once fewer than the maximum number of serializations are 
+        running.
+
+        - parameter closure: The closure to run.
+    */
+    public func execute(closure: () -> Void) {
+        operationQueue.addOperationWithBlock(closure)
+    }
+}
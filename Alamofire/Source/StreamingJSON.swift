@@ -0,0 +1,336 @@
+// StreamingJSON.swift
+//
+// Copyright (c) 2014–2015 Alamofire Software Foundation (http://alamofire.org/)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+import Foundation
+
+/**
+    An incremental JSON parser that emits the elements of a top-level array as soon as each one has been received.
+
+    Bytes are fed in with `appendData(_:)` in the order they arrive and may be split anywhere, including inside 
+    strings and escape sequences. Only the bytes of the element currently being received are buffered; each complete 
+    element is parsed with `NSJSONSerialization` and handed to the element handler, after which its bytes are 
+    released. A top-level value that is not an array cannot be split up, so it is buffered in full and emitted as a 
+    single element by `finish()`.
+*/
+public final class JSONStreamParser {
+
+    /// The JSON reading options used to parse each element. `.AllowFragments` is always added.
+    public let options: NSJSONReadingOptions
+
+    /// The number of elements emitted so far.
+    public private(set) var elementCount = 0
+
+    private enum State {
+        case Start
+        case Array
+        case Value
+        case Finished
+    }
+
+    private let elementHandler: AnyObject -> Void
+
+    private var state: State = .Start
+    private var depth = 0
+    private var inString = false
+    private var escaped = false
+    private var inElement = false
+    private var awaitingSeparator = false
+    private var awaitingElement = false
+    private var elementBytes: [UInt8] = []
+
+    /**
+        Initializes the `JSONStreamParser` instance with the specified options and element handler.
+
+        - parameter options:        The JSON reading options. `.AllowFragments` by default.
+        - parameter elementHandler: The closure called with each element, in order, on the thread feeding the parser.
+
+        - returns: The new `JSONStreamParser` instance.
+    */
+    public init(options: NSJSONReadingOptions = .AllowFragments, elementHandler: AnyObject -> Void) {
+        self.options = options.union(.AllowFragments)
+        self.elementHandler = elementHandler
+    }
+
+    /**
+        Parses the next chunk of the document, emitting every element it completes.
+
+        - parameter data: The bytes received after those previously appended.
+
+        - throws: An `NSError` if the chunk makes the document invalid. The parser must not be used afterwards.
+    */
+    public func appendData(data: NSData) throws {
+        let bytes = UnsafeBufferPointer(start: UnsafePointer<UInt8>(data.bytes), count: data.length)
+        var elementStart: Int? = inElement ? 0 : nil
+        var index = 0
+
+        while index < bytes.count {
+            let byte = bytes[index]
+
+            switch state {
+            case .Finished:
+                guard isWhitespace(byte) else {
+                    throw streamError("JSON could not be serialized. Unexpected data after the top-level array.")
+                }
+            case .Value:
+                elementBytes.appendContentsOf(UnsafeBufferPointer(start: bytes.baseAddress + index, count: bytes.count - index))
+                return
+            case .Start:
+                if byte == ASCII.LeftBracket {
+                    state = .Array
+                    depth = 1
+                } else if !isWhitespace(byte) {
+                    state = .Value
+                    continue
+                }
+            case .Array:
+                if inString {
+                    if escaped {
+                        escaped = false
+                    } else if byte == ASCII.Backslash {
+                        escaped = true
+                    } else if byte == ASCII.Quote {
+                        inString = false
+
+                        if depth == 1 {
+                            try completeElement(bytes, start: elementStart, end: index + 1)
+                            elementStart = nil
+                        }
+                    }
+                } else if inElement && depth > 1 {
+                    if byte == ASCII.Quote {
+                        inString = true
+                    } else if byte == ASCII.LeftBracket || byte == ASCII.LeftBrace {
+                        depth += 1
+                    } else if byte == ASCII.RightBracket || byte == ASCII.RightBrace {
+                        depth -= 1
+
+                        if depth == 1 {
+                            try completeElement(bytes, start: elementStart, end: index + 1)
+                            elementStart = nil
+                        }
+                    }
+                } else if inElement {
+                    // A number or literal ends at the first byte that cannot be part of it
+                    if !isScalarByte(byte) {
+                        try completeElement(bytes, start: elementStart, end: index)
+                        elementStart = nil
+                        continue
+                    }
+                } else if isWhitespace(byte) {
+                    break
+                } else if byte == ASCII.Comma {
+                    guard awaitingSeparator else {
+                        throw streamError("JSON could not be serialized. Unexpected ',' in the top-level array.")
+                    }
+
+                    awaitingSeparator = false
+                    awaitingElement = true
+                } else if byte == ASCII.RightBracket {
+                    guard !awaitingElement else {
+                        throw streamError("JSON could not be serialized. Trailing ',' in the top-level array.")
+                    }
+
+                    depth = 0
+                    state = .Finished
+                } else {
+                    guard !awaitingSeparator && byte != ASCII.RightBrace else {
+                        throw streamError("JSON could not be serialized. Expected ',' or ']' in the top-level array.")
+                    }
+
+                    inElement = true
+                    awaitingElement = false
+                    elementStart = index
+
+                    if byte == ASCII.Quote {
+                        inString = true
+                    } else if byte == ASCII.LeftBracket || byte == ASCII.LeftBrace {
+                        depth += 1
+                    }
+                }
+            }
+
+            index += 1
+        }
+
+        if let elementStart = elementStart where inElement {
+            elementBytes.appendContentsOf(UnsafeBufferPointer(start: bytes.baseAddress + elementStart, count: bytes.count - elementStart))
+        }
+    }
+
+    /**
+        Completes the document once all of its bytes have been appended.
+
+        - throws: An `NSError` if the document is empty, incomplete or invalid.
+    */
+    public func finish() throws {
+        switch state {
+        case .Start:
+            throw streamError("JSON could not be serialized. Input data was nil or zero length.")
+        case .Array:
+            throw streamError("JSON could not be serialized. Input data ended inside the top-level array.")
+        case .Value:
+            let data = NSData(bytes: elementBytes, length: elementBytes.count)
+            elementBytes = []
+            try emitElement(data)
+            state = .Finished
+        case .Finished:
+            break
+        }
+    }
+
+    // MARK: - Private - Elements
+
+    private func completeElement(bytes: UnsafeBufferPointer<UInt8>, start: Int?, end: Int) throws {
+        inElement = false
+        awaitingSeparator = true
+
+        let start = start ?? 0
+
+        if elementBytes.isEmpty {
+            // The whole element arrived in this chunk, so it can be parsed in place
+            let pointer = UnsafeMutablePointer<Void>(bytes.baseAddress + start)
+            try emitElement(NSData(bytesNoCopy: pointer, length: end - start, freeWhenDone: false))
+        } else {
+            elementBytes.appendContentsOf(UnsafeBufferPointer(start: bytes.baseAddress + start, count: end - start))
+            let data = NSData(bytes: elementBytes, length: elementBytes.count)
+            elementBytes.removeAll(keepCapacity: true)
+            try emitElement(data)
+        }
+    }
+
+    private func emitElement(data: NSData) throws {
+        let element = try NSJSONSerialization.JSONObjectWithData(data, options: options)
+        elementCount += 1
+        elementHandler(element)
+    }
+
+    // MARK: - Private - Bytes
+
+    private struct ASCII {
+        static let Quote: UInt8 = 0x22
+        static let Comma: UInt8 = 0x2C
+        static let LeftBracket: UInt8 = 0x5B
+        static let Backslash: UInt8 = 0x5C
+        static let RightBracket: UInt8 = 0x5D
+        static let LeftBrace: UInt8 = 0x7B
+        static let RightBrace: UInt8 = 0x7D
+    }
+
+    private func isWhitespace(byte: UInt8) -> Bool {
+        return byte == 0x20 || byte == 0x0A || byte == 0x0D || byte == 0x09
+    }
+
+    private func isScalarByte(byte: UInt8) -> Bool {
+        switch byte {
+        case 0x30...0x39, 0x41...0x5A, 0x61...0x7A, 0x2B, 0x2D, 0x2E:
+            return true
+        default:
+            return false
+        }
+    }
+
+    private func streamError(failureReason: String) -> NSError {
+        return Error.errorWithCode(.JSONSerializationFailed, failureReason: failureReason)
+    }
+}
+
+// MARK: - Streaming JSON
+
+extension Request {
+
+    /**
+        Adds handlers that parse the response as JSON while it is being received.
+
+        Each element of a top-level array is parsed as soon as its last byte arrives and passed to the element 
+        handler, so parsing overlaps the transfer and the response is never buffered in full. The response data is 
+        consumed through `stream(_:)`, which must not be set separately, and is `nil` in the completion handler.
+
+        Elements are delivered before the request completes, and so before any validation runs. A validation or 
+        parsing error is reported to the completion handler, whose result is otherwise the number of elements.
+
+        - parameter queue:             The serial queue on which the handlers are dispatched. The main queue by 
+                                       default.
+        - parameter options:           The JSON serialization reading options. `.AllowFragments` by default.
+        - parameter elementHandler:    A closure to be executed with each element of the top-level array. A value 
+                                       that is not an array is passed to it as a single element.
+        - parameter completionHandler: A closure to be executed once the request has finished and all elements have 
+                                       been delivered.
+
+        - returns: The request.
+    */
+    public func responseJSON(
+        queue queue: dispatch_queue_t? = nil,
+        options: NSJSONReadingOptions = .AllowFragments,
+        elementHandler: AnyObject -> Void,
+        completionHandler: Response<Int, NSError> -> Void)
+        -> Self
+    {
+        let queue = queue ?? dispatch_get_main_queue()
+        let parser = JSONStreamParser(options: options) { element in
+            dispatch_async(queue) { elementHandler(element) }
+        }
+
+        var parserError: NSError?
+
+        stream { data in
+            guard parserError == nil else { return }
+
+            do {
+                try parser.appendData(data)
+            } catch {
+                parserError = error as NSError
+            }
+        }
+
+        addSerialization(
+            queue: queue,
+            serialization: { () -> Result<Int, NSError> in
+                if let error = self.delegate.error ?? parserError {
+                    return .Failure(error)
+                } else if let response = self.response where response.statusCode == 204 && parser.elementCount == 0 {
+                    return .Success(0)
+                }
+
+                do {
+                    try parser.finish()
+                    return .Success(parser.elementCount)
+                } catch {
+                    return .Failure(error as NSError)
+                }
+            },
+            completion: { result, timeline in
+                let response = Response<Int, NSError>(
+                    request: self.request,
+                    response: self.response,
+                    data: nil,
+                    result: result,
+                    timeline: timeline
+                )
+
+                completionHandler(response)
+                self.metricsSink?(self, timeline)
+            }
+        )
+
+        return self
+    }
+}
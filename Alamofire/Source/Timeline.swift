@@ -0,0 +1,124 @@
+// Timeline.swift
+//
+// Copyright (c) 2014–2015 Alamofire Software Foundation (http://alamofire.org/)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+import Foundation
+
+/**
+    The timing of the phases of a `Request`, from its creation until a response handler is called.
+
+    All times are `CFAbsoluteTime` values. A phase the request skipped, such as the task transfer for a response served 
+    from a `ResponseCache`, takes no time: its time is the same as that of the previous phase.
+
+    `NSURLSession` does not report DNS lookup, connection and TLS handshake times on their own, so they are part of 
+    the `latency`.
+*/
+public struct Timeline {
+    /// The time the request was created.
+    public let requestStartTime: CFAbsoluteTime
+
+    /// The time the task of the request was first resumed.
+    public let taskResumeTime: CFAbsoluteTime
+
+    /// The time the first response or bytes of the request were received from the server.
+    public let initialResponseTime: CFAbsoluteTime
+
+    /// The time the task of the request completed.
+    public let requestCompletedTime: CFAbsoluteTime
+
+    /// The time the response serializer finished.
+    public let serializationCompletedTime: CFAbsoluteTime
+
+    /// The time the response handler was called on its queue.
+    public let completionHandlerStartTime: CFAbsoluteTime
+
+    /// The time between the creation of the request and the first resume of its task.
+    public let queueDuration: NSTimeInterval
+
+    /// The time between resuming the task and receiving the first response, including DNS lookup, connection, TLS 
+    /// handshake and the time to first byte.
+    public let latency: NSTimeInterval
+
+    /// The time between the first response and the completion of the task.
+    public let transferDuration: NSTimeInterval
+
+    /// The time taken by the response serializer.
+    public let serializationDuration: NSTimeInterval
+
+    /// The time between the end of serialization and the start of the response handler on its queue.
+    public let dispatchDuration: NSTimeInterval
+
+    /// The time between the creation of the request and the start of the response handler.
+    public let totalDuration: NSTimeInterval
+
+    /**
+        Initializes the `Timeline` instance with the specified times.
+
+        - parameter requestStartTime:           The time the request was created. `0.0` by default.
+        - parameter taskResumeTime:             The time the task was first resumed. `0.0` by default.
+        - parameter initialResponseTime:        The time the first response was received. `0.0` by default.
+        - parameter requestCompletedTime:       The time the task completed. `0.0` by default.
+        - parameter serializationCompletedTime: The time the response serializer finished. `0.0` by default.
+        - parameter completionHandlerStartTime: The time the response handler was called. `0.0` by default.
+
+        - returns: The new `Timeline` instance.
+    */
+    public init(
+        requestStartTime: CFAbsoluteTime = 0.0,
+        taskResumeTime: CFAbsoluteTime = 0.0,
+        initialResponseTime: CFAbsoluteTime = 0.0,
+        requestCompletedTime: CFAbsoluteTime = 0.0,
+        serializationCompletedTime: CFAbsoluteTime = 0.0,
+        completionHandlerStartTime: CFAbsoluteTime = 0.0)
+    {
+        self.requestStartTime = requestStartTime
+        self.taskResumeTime = max(taskResumeTime, requestStartTime)
+        self.initialResponseTime = max(initialResponseTime, self.taskResumeTime)
+        self.requestCompletedTime = max(requestCompletedTime, self.initialResponseTime)
+        self.serializationCompletedTime = max(serializationCompletedTime, self.requestCompletedTime)
+        self.completionHandlerStartTime = max(completionHandlerStartTime, self.serializationCompletedTime)
+
+        self.queueDuration = self.taskResumeTime - self.requestStartTime
+        self.latency = self.initialResponseTime - self.taskResumeTime
+        self.transferDuration = self.requestCompletedTime - self.initialResponseTime
+        self.serializationDuration = self.serializationCompletedTime - self.requestCompletedTime
+        self.dispatchDuration = self.completionHandlerStartTime - self.serializationCompletedTime
+        self.totalDuration = self.completionHandlerStartTime - self.requestStartTime
+    }
+}
+
+// MARK: - CustomStringConvertible
+
+extension Timeline: CustomStringConvertible {
+    /// The textual representation used when written to an output stream, which includes the durations of the phases.
+    public var description: String {
+        let durations = [
+            "\"Queue\": \(queueDuration) secs",
+            "\"Latency\": \(latency) secs",
+            "\"Transfer\": \(transferDuration) secs",
+            "\"Serialization\": \(serializationDuration) secs",
+            "\"Dispatch\": \(dispatchDuration) secs",
+            "\"Total\": \(totalDuration) secs"
+        ]
+
+        return "Timeline: { " + durations.joinWithSeparator(", ") + " }"
+    }
+}
@@ -51,6 +51,7 @@ extension Manager {
         }
 
         let request = Request(session: session, task: uploadTask)
+        prepareRequest(request)
 
         if HTTPBodyStream != nil {
             request.delegate.taskNeedNewBodyStream = { _, _ in
@@ -314,7 +315,10 @@ extension Manager {
 
                 do {
                     try fileManager.createDirectoryAtURL(directoryURL, withIntermediateDirectories: true, attributes: nil)
-                    try formData.writeEncodedDataToDisk(fileURL)
+                    try formData.writeEncodedDataToDisk(
+                        fileURL,
+                        maximumConcurrentBodyParts: NSProcessInfo.processInfo().activeProcessorCount
+                    )
 
                     dispatch_async(dispatch_get_main_queue()) {
                         let encodingResult = MultipartFormDataEncodingResult.Success(
@@ -332,6 +336,34 @@ extension Manager {
             }
         }
     }
+
+    /**
+        Creates a request for streaming the `MultipartFormData` to the specified URL request, encoding the body parts 
+        while they are being sent.
+
+        Unlike `upload(_:multipartFormData:encodingMemoryThreshold:encodingCompletion:)`, the payload is never encoded 
+        in memory or written to a temporary file, whatever its size. The `Content-Type` and `Content-Length` HTTP 
+        headers are set from the form data. Background sessions cannot upload streams, so use the file-based variant 
+        with them.
+
+        If `startRequestsImmediately` is `true`, the request will have `resume()` called before being returned.
+
+        - parameter URLRequest:        The URL request.
+        - parameter multipartFormData: The form data to upload. Its body parts can only be encoded once.
+
+        - throws: An `NSError` if appending a body part to the form data encountered an error.
+
+        - returns: The created upload request.
+    */
+    public func upload(URLRequest: URLRequestConvertible, streamingMultipartFormData multipartFormData: MultipartFormData) throws -> Request {
+        let stream = try multipartFormData.encodedStream()
+
+        let mutableURLRequest = URLRequest.URLRequest
+        mutableURLRequest.setValue(multipartFormData.contentType, forHTTPHeaderField: "Content-Type")
+        mutableURLRequest.setValue("\(multipartFormData.encodedContentLength)", forHTTPHeaderField: "Content-Length")
+
+        return upload(.Stream(mutableURLRequest, stream))
+    }
 }
 
 // MARK: -
@@ -344,6 +376,9 @@ extension Request {
         var uploadTask: NSURLSessionUploadTask? { return task as? NSURLSessionUploadTask }
         var uploadProgress: ((Int64, Int64, Int64) -> Void)!
 
+        // The body of an upload task belongs to the task, so it cannot be sent again with a new data task
+        override var canRetry: Bool { return false }
+
         // MARK: - NSURLSessionTaskDelegate
 
         // MARK: Override Closures
@@ -362,8 +397,7 @@ extension Request {
             if let taskDidSendBodyData = taskDidSendBodyData {
                 taskDidSendBodyData(session, task, bytesSent, totalBytesSent, totalBytesExpectedToSend)
             } else {
-                progress.totalUnitCount = totalBytesExpectedToSend
-                progress.completedUnitCount = totalBytesSent
+                updateProgressWithTotalBytes(totalBytesSent, totalBytesExpected: totalBytesExpectedToSend)
 
                 uploadProgress?(bytesSent, totalBytesSent, totalBytesExpectedToSend)
             }
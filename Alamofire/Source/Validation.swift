@@ -51,7 +51,7 @@ extension Request {
         - returns: The request.
     */
     public func validate(validation: Validation) -> Self {
-        delegate.queue.addOperationWithBlock {
+        delegate.handlerQueue.addOperationWithBlock {
             if let
                 response = self.response where self.delegate.error == nil,
                 case let .Failure(error) = validation(self.request, response)
@@ -164,6 +164,30 @@ extension Request {
         }
     }
 
+    // MARK: - Compiled
+
+    /**
+        Validates the request with the specified compiled validator.
+
+        If validation fails, subsequent calls to response handlers will have an associated error.
+
+        - parameter validator: The compiled validator, which may be shared by any number of requests.
+
+        - returns: The request.
+    */
+    public func validate(validator: CompiledValidator) -> Self {
+        delegate.handlerQueue.addOperationWithBlock {
+            if let
+                response = self.response where self.delegate.error == nil,
+                case let .Failure(error) = validator.validate(response, dataLength: self.delegate.data?.length ?? 0)
+            {
+                self.delegate.error = error
+            }
+        }
+
+        return self
+    }
+
     // MARK: - Automatic
 
     /**
@@ -175,15 +199,193 @@ extension Request {
         - returns: The request.
     */
     public func validate() -> Self {
-        let acceptableStatusCodes: Range<Int> = 200..<300
-        let acceptableContentTypes: [String] = {
-            if let accept = request?.valueForHTTPHeaderField("Accept") {
-                return accept.componentsSeparatedByString(",")
+        return validate(CompiledValidator.automaticValidatorForAccept(request?.valueForHTTPHeaderField("Accept")))
+    }
+}
+
+// MARK: -
+
+/**
+    A status code and content type validator parsed once and then shared by any number of requests.
+
+    The acceptable status codes are stored as a bitset, and the acceptable content types as hash sets of full MIME 
+    types and of the types and subtypes of wildcard patterns, so validating a response takes constant time no matter 
+    how many codes and content types are acceptable.
+*/
+public final class CompiledValidator {
+
+    // MARK: - Properties
+
+    // One bit per status code in 0..<1024, which covers every HTTP status code
+    private static let StatusCodeCapacity = 1024
+    private let statusCodeBits: [UInt64]
+
+    private let validatesContentType: Bool
+    private let acceptsAnyMIMEType: Bool
+    private let MIMETypes: Set<String>
+    private let wildcardSubtypeTypes: Set<String>
+    private let wildcardTypeSubtypes: Set<String>
+    private let acceptableContentTypesDescription: String
+
+    private static let automaticValidatorLock = NSLock()
+    private static var automaticValidatorsByAccept: [String: CompiledValidator] = [:]
+
+    // MARK: - Lifecycle
+
+    /**
+        Initializes the `CompiledValidator` instance with the specified acceptable status codes and content types.
+
+        - parameter statusCode:  The acceptable status codes. Codes outside `0..<1024` are ignored. `200..<300` by 
+                                 default.
+        - parameter contentType: The acceptable content types, which may specify wildcard types and/or subtypes. If 
+                                 `nil`, the content type is not validated. `nil` by default.
+
+        - returns: The new `CompiledValidator` instance.
+    */
+    public init<S: SequenceType where S.Generator.Element == Int>(
+        statusCode acceptableStatusCodes: S,
+        contentType acceptableContentTypes: [String]? = nil)
+    {
+        var statusCodeBits = [UInt64](count: CompiledValidator.StatusCodeCapacity / 64, repeatedValue: 0)
+
+        if let range = acceptableStatusCodes as? Range<Int> {
+            // Avoids walking huge ranges one code at a time
+            let lowerBound = max(range.startIndex, 0)
+            let upperBound = min(range.endIndex, CompiledValidator.StatusCodeCapacity)
+
+            if lowerBound < upperBound {
+                for statusCode in lowerBound..<upperBound {
+                    statusCodeBits[statusCode >> 6] |= 1 << UInt64(statusCode & 63)
+                }
             }
+        } else {
+            for statusCode in acceptableStatusCodes where statusCode >= 0 && statusCode < CompiledValidator.StatusCodeCapacity {
+                statusCodeBits[statusCode >> 6] |= 1 << UInt64(statusCode & 63)
+            }
+        }
+
+        self.statusCodeBits = statusCodeBits
+
+        var acceptsAnyMIMEType = false
+        var MIMETypes: Set<String> = []
+        var wildcardSubtypeTypes: Set<String> = []
+        var wildcardTypeSubtypes: Set<String> = []
+
+        for contentType in acceptableContentTypes ?? [] {
+            guard let components = CompiledValidator.MIMETypeComponents(contentType) else { continue }
+
+            let (type, subtype) = components
+
+            switch (type, subtype) {
+            case ("*", "*"):
+                acceptsAnyMIMEType = true
+            case (_, "*"):
+                wildcardSubtypeTypes.insert(type)
+            case ("*", _):
+                wildcardTypeSubtypes.insert(subtype)
+            default:
+                MIMETypes.insert(type + "/" + subtype)
+            }
+        }
+
+        self.validatesContentType = acceptableContentTypes != nil
+        self.acceptsAnyMIMEType = acceptsAnyMIMEType
+        self.MIMETypes = MIMETypes
+        self.wildcardSubtypeTypes = wildcardSubtypeTypes
+        self.wildcardTypeSubtypes = wildcardTypeSubtypes
+        self.acceptableContentTypesDescription = "\(acceptableContentTypes ?? [])"
+    }
+
+    /**
+        Initializes the `CompiledValidator` instance accepting status codes in 200..<300 and the specified content types.
+
+        - parameter contentType: The acceptable content types, which may specify wildcard types and/or subtypes.
+
+        - returns: The new `CompiledValidator` instance.
+    */
+    public convenience init(contentType acceptableContentTypes: [String]) {
+        self.init(statusCode: 200..<300, contentType: acceptableContentTypes)
+    }
+
+    // MARK: - Validation
+
+    /**
+        Validates the specified response.
+
+        - parameter response:   The response.
+        - parameter dataLength: The length of the response data. The content type is only validated for responses with 
+                                data.
+
+        - returns: The validation result.
+    */
+    public func validate(response: NSHTTPURLResponse, dataLength: Int) -> Request.ValidationResult {
+        let statusCode = response.statusCode
+
+        guard statusCode >= 0 && statusCode < CompiledValidator.StatusCodeCapacity &&
+            statusCodeBits[statusCode >> 6] & (1 << UInt64(statusCode & 63)) != 0 else
+        {
+            let failureReason = "Response status code was unacceptable: \(statusCode)"
+            return .Failure(Error.errorWithCode(.StatusCodeValidationFailed, failureReason: failureReason))
+        }
+
+        guard validatesContentType && !acceptsAnyMIMEType && dataLength > 0 else { return .Success }
+
+        if let
+            responseContentType = response.MIMEType,
+            components = CompiledValidator.MIMETypeComponents(responseContentType)
+            where MIMETypes.contains(components.type + "/" + components.subtype) ||
+                wildcardSubtypeTypes.contains(components.type) ||
+                wildcardTypeSubtypes.contains(components.subtype)
+        {
+            return .Success
+        }
+
+        let failureReason: String
+
+        if let responseContentType = response.MIMEType {
+            failureReason = (
+                "Response content type \"\(responseContentType)\" does not match any acceptable " +
+                "content types: \(acceptableContentTypesDescription)"
+            )
+        } else {
+            failureReason = "Response content type was missing and acceptable content type does not match \"*/*\""
+        }
+
+        return .Failure(Error.errorWithCode(.ContentTypeValidationFailed, failureReason: failureReason))
+    }
+
+    // MARK: - Private
+
+    private static func MIMETypeComponents(string: String) -> (type: String, subtype: String)? {
+        let stripped = string.stringByTrimmingCharactersInSet(NSCharacterSet.whitespaceAndNewlineCharacterSet())
+        let split = stripped.substringToIndex(stripped.rangeOfString(";")?.startIndex ?? stripped.endIndex)
+        let components = split.lowercaseString.componentsSeparatedByString("/")
+
+        guard let type = components.first, subtype = components.last else { return nil }
+
+        return (type, subtype)
+    }
+
+    /// Returns the validator for the `Accept` header value, compiling it the first time the value is seen.
+    static func automaticValidatorForAccept(accept: String?) -> CompiledValidator {
+        let key = accept ?? "*/*"
+
+        automaticValidatorLock.lock()
+        defer { automaticValidatorLock.unlock() }
+
+        if let validator = automaticValidatorsByAccept[key] {
+            return validator
+        }
+
+        let validator = CompiledValidator(contentType: key.componentsSeparatedByString(","))
+
+        // Accept values are few in practice; a bound keeps unusual clients from growing the cache forever
+        if automaticValidatorsByAccept.count >= 64 {
+            automaticValidatorsByAccept.removeAll()
+        }
 
-            return ["*/*"]
-        }()
+        automaticValidatorsByAccept[key] = validator
 
-        return validate(statusCode: acceptableStatusCodes).validate(contentType: acceptableContentTypes)
+        return validator
     }
 }
@@ -0,0 +1,205 @@
+// BatchRequestTests.swift
+//
+// Copyright (c) 2014–2015 Alamofire Software Foundation (http://alamofire.org/)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+import Alamofire
+import Foundation
+import XCTest
+
+class BatchRequestTestCase: BaseTestCase {
+    var manager: Manager!
+
+    override func setUp() {
+        super.setUp()
+
+        // Requests are answered with their path, after the delay in milliseconds given by the `delay` query item.
+        // Requests for `/fail` fail with a connection error.
+        StandInURLProtocol.reset()
+        StandInURLProtocol.responder = { request, _ in
+            let components = NSURLComponents(URL: request.URL!, resolvingAgainstBaseURL: false)
+            let delayItem = components?.queryItems?.filter { $0.name == "delay" }.first
+            let delay = Double(delayItem?.value.flatMap { Int($0) } ?? 0) / 1000
+            let path = request.URL?.path ?? ""
+
+            guard path != "/fail" else {
+                let error = NSError(domain: NSURLErrorDomain, code: NSURLErrorCannotConnectToHost, userInfo: nil)
+                return StandInURLProtocol.Reply(statusCode: nil, error: error, delay: delay)
+            }
+
+            return StandInURLProtocol.Reply(body: path, delay: delay)
+        }
+
+        manager = Manager(configuration: StandInURLProtocol.sessionConfiguration())
+    }
+
+    func URLRequestsForPaths(paths: [String], delays: [Int]) -> [URLRequestConvertible] {
+        return zip(paths, delays).map { path, delay in
+            NSURLRequest(URL: NSURL(string: "https://batch.example.com\(path)?delay=\(delay)")!) as URLRequestConvertible
+        }
+    }
+
+    func stringForResult(result: Result<NSData, NSError>) -> String? {
+        return result.value.flatMap { String(data: $0, encoding: NSUTF8StringEncoding) }
+    }
+
+    func testThatBatchDeliversResultsInRequestOrder() {
+        // Given
+        let URLRequests = URLRequestsForPaths(["/a", "/b", "/c", "/d"], delays: [80, 10, 40, 0])
+        let expectation = expectationWithDescription("batch should complete")
+
+        var strings: [String?] = []
+
+        // When
+        manager.batchRequest(URLRequests).responseData { results in
+            strings = results.map { self.stringForResult($0) }
+            expectation.fulfill()
+        }
+
+        waitForExpectationsWithTimeout(timeout, handler: nil)
+
+        // Then
+        XCTAssertEqual(strings.flatMap { $0 }, ["/a", "/b", "/c", "/d"], "results should be in the order of the requests")
+    }
+
+    func testThatBatchReportsFailuresPerItem() {
+        // Given
+        let URLRequests = URLRequestsForPaths(["/a", "/fail", "/c"], delays: [0, 0, 0])
+        let expectation = expectationWithDescription("batch should complete")
+
+        var results: [Result<NSData, NSError>] = []
+
+        // When
+        manager.batchRequest(URLRequests).responseData { batchResults in
+            results = batchResults
+            expectation.fulfill()
+        }
+
+        waitForExpectationsWithTimeout(timeout, handler: nil)
+
+        // Then
+        XCTAssertEqual(results.count, 3, "there should be one result per request")
+
+        if results.count == 3 {
+            XCTAssertTrue(results[0].isSuccess, "first result should be a success")
+            XCTAssertTrue(results[1].isFailure, "second result should be a failure")
+            XCTAssertEqual(results[1].error?.code ?? 0, NSURLErrorCannotConnectToHost, "error code should match")
+            XCTAssertTrue(results[2].isSuccess, "third result should be a success")
+        }
+    }
+
+    func testThatItemHandlerFollowsRequestOrderingMode() {
+        // Given
+        let URLRequests = URLRequestsForPaths(["/a", "/b", "/c"], delays: [150, 0, 50])
+        let expectation = expectationWithDescription("batch should complete")
+
+        var itemIndexes: [Int] = []
+        var itemIndexesBeforeCompletion: [Int] = []
+
+        // When
+        manager.batchRequest(URLRequests).responseData(
+            ordering: .RequestOrder,
+            itemHandler: { index, _ in
+                itemIndexes.append(index)
+            },
+            completionHandler: { _ in
+                itemIndexesBeforeCompletion = itemIndexes
+                expectation.fulfill()
+            }
+        )
+
+        waitForExpectationsWithTimeout(timeout, handler: nil)
+
+        // Then
+        XCTAssertEqual(itemIndexes, [0, 1, 2], "items should be delivered in the order of the requests")
+        XCTAssertEqual(itemIndexesBeforeCompletion, [0, 1, 2], "every item should be delivered before the completion")
+    }
+
+    func testThatItemHandlerFollowsCompletionOrderingMode() {
+        // Given
+        let URLRequests = URLRequestsForPaths(["/a", "/b"], delays: [300, 0])
+        let expectation = expectationWithDescription("batch should complete")
+
+        var itemIndexes: [Int] = []
+
+        // When
+        manager.batchRequest(URLRequests).responseData(
+            ordering: .CompletionOrder,
+            itemHandler: { index, _ in
+                itemIndexes.append(index)
+            },
+            completionHandler: { _ in
+                expectation.fulfill()
+            }
+        )
+
+        waitForExpectationsWithTimeout(timeout, handler: nil)
+
+        // Then
+        XCTAssertEqual(itemIndexes, [1, 0], "items should be delivered as their requests finish")
+    }
+
+    func testThatItemHandlersRunInOrderBeforeCompletionOnConcurrentQueue() {
+        // Given
+        let URLRequests = URLRequestsForPaths(["/a", "/b", "/c", "/d"], delays: [60, 0, 30, 10])
+        let queue = dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0)
+        let expectation = expectationWithDescription("batch should complete")
+
+        var itemIndexes: [Int] = []
+        var itemIndexesBeforeCompletion: [Int] = []
+
+        // When
+        manager.batchRequest(URLRequests).responseData(
+            queue: queue,
+            ordering: .RequestOrder,
+            itemHandler: { index, _ in
+                usleep(10_000)
+                itemIndexes.append(index)
+            },
+            completionHandler: { _ in
+                itemIndexesBeforeCompletion = itemIndexes
+                expectation.fulfill()
+            }
+        )
+
+        waitForExpectationsWithTimeout(timeout, handler: nil)
+
+        // Then
+        XCTAssertEqual(itemIndexesBeforeCompletion, [0, 1, 2, 3], "items should run one at a time, before the completion")
+    }
+
+    func testThatEmptyBatchCompletesWithNoResults() {
+        // Given
+        let expectation = expectationWithDescription("batch should complete")
+
+        var resultCount: Int?
+
+        // When
+        manager.batchRequest([]).responseData { results in
+            resultCount = results.count
+            expectation.fulfill()
+        }
+
+        waitForExpectationsWithTimeout(timeout, handler: nil)
+
+        // Then
+        XCTAssertEqual(resultCount ?? -1, 0, "empty batch should complete with no results")
+    }
+}
@@ -0,0 +1,206 @@
+// ChunkedDataTests.swift
+//
+// Copyright (c) 2014–2015 Alamofire Software Foundation (http://alamofire.org/)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+import Alamofire
+import Foundation
+import XCTest
+
+class ChunkedDataTestCase: BaseTestCase {
+    let chunkLength = 64 * 1024
+    let chunkCount = 256
+
+    func chunks() -> [NSData] {
+        return (0..<chunkCount).map { index in
+            let bytes = [UInt8](count: chunkLength, repeatedValue: UInt8(truncatingBitPattern: index))
+            return NSData(bytes: bytes, length: bytes.count)
+        }
+    }
+
+    // MARK: - Tests
+
+    func testThatAppendingDataRetainsChunksWithoutCopying() {
+        // Given
+        let chunkedData = ChunkedData()
+        let first = "first".dataUsingEncoding(NSUTF8StringEncoding)!
+        let second = "second".dataUsingEncoding(NSUTF8StringEncoding)!
+
+        // When
+        chunkedData.appendData(first)
+        chunkedData.appendData(NSData())
+        chunkedData.appendData(second)
+
+        // Then
+        XCTAssertEqual(chunkedData.length, 11, "length should be 11")
+        XCTAssertEqual(chunkedData.chunks.count, 2, "chunks count should be 2")
+        XCTAssertTrue(chunkedData.chunks.first === first, "first chunk should be the appended data")
+        XCTAssertTrue(chunkedData.chunks.last === second, "last chunk should be the appended data")
+    }
+
+    func testThatEnumerateBytesReadsChunksInPlaceWithOffsets() {
+        // Given
+        let chunkedData = ChunkedData()
+        let first = "first".dataUsingEncoding(NSUTF8StringEncoding)!
+        let second = "second".dataUsingEncoding(NSUTF8StringEncoding)!
+        chunkedData.appendData(first)
+        chunkedData.appendData(second)
+
+        var offsets: [Int] = []
+        var baseAddresses: [UnsafePointer<UInt8>] = []
+
+        // When
+        chunkedData.enumerateBytes { bytes, offset in
+            offsets.append(offset)
+            baseAddresses.append(bytes.baseAddress)
+            return true
+        }
+
+        // Then
+        XCTAssertEqual(offsets, [0, 5], "offsets should match expected value")
+        XCTAssertEqual(baseAddresses, [UnsafePointer<UInt8>(first.bytes), UnsafePointer<UInt8>(second.bytes)], "bytes should not be copied")
+    }
+
+    func testThatEnumerateBytesStopsWhenClosureReturnsFalse() {
+        // Given
+        let chunkedData = ChunkedData()
+        chunks().forEach { chunkedData.appendData($0) }
+
+        var calls = 0
+
+        // When
+        chunkedData.enumerateBytes { _, _ in
+            calls += 1
+            return false
+        }
+
+        // Then
+        XCTAssertEqual(calls, 1, "calls should be 1")
+    }
+
+    func testThatContiguousDataMatchesConcatenatedChunksAndReplacesThem() {
+        // Given
+        let chunkedData = ChunkedData()
+        let expectedData = NSMutableData()
+
+        for chunk in chunks() {
+            chunkedData.appendData(chunk)
+            expectedData.appendData(chunk)
+        }
+
+        // When
+        let data = chunkedData.contiguousData()
+
+        // Then
+        XCTAssertEqual(data, expectedData, "contiguous data should equal the concatenated chunks")
+        XCTAssertEqual(chunkedData.chunks.count, 1, "chunks count should be 1")
+        XCTAssertTrue(chunkedData.contiguousData() === data, "contiguous data should only be produced once")
+    }
+
+    func testThatContiguousDataReleasesEachChunkOnceCopied() {
+        // Given
+        let chunkedData = ChunkedData()
+        var events: [String] = []
+
+        autoreleasepool {
+            for (index, chunk) in chunks().prefix(3).enumerate() {
+                chunkedData.appendData(RecordingData(name: "\(index)", storage: chunk) { events.append($0) })
+            }
+        }
+
+        // When
+        var data = NSData()
+        autoreleasepool { data = chunkedData.contiguousData() }
+
+        // Then
+        let firstChunkReleaseIndex = events.indexOf("release 0")
+        let lastChunkReadIndex = events.indexOf("read 2")
+
+        XCTAssertEqual(data.length, 3 * chunkLength, "data length should be the length of all chunks")
+        XCTAssertNotNil(firstChunkReleaseIndex, "first chunk should be released")
+        XCTAssertNotNil(lastChunkReadIndex, "last chunk should be read")
+        XCTAssertLessThan(firstChunkReleaseIndex ?? Int.max, lastChunkReadIndex ?? Int.min, "first chunk should be released before last chunk is read")
+        XCTAssertEqual(events.filter { $0.hasPrefix("release") }.count, 3, "every chunk should be released")
+    }
+
+    func testThatContiguousDataIsEmptyWithNoChunks() {
+        // Given, When
+        let data = ChunkedData().contiguousData()
+
+        // Then
+        XCTAssertEqual(data.length, 0, "data length should be 0")
+    }
+
+    // MARK: - Benchmarks
+
+    func testPerformanceOfAccumulatingChunksInMutableData() {
+        let chunks = self.chunks()
+
+        measureBlock {
+            let mutableData = NSMutableData()
+            chunks.forEach { mutableData.appendData($0) }
+            XCTAssertEqual(mutableData.length, self.chunkLength * self.chunkCount)
+        }
+    }
+
+    func testPerformanceOfAccumulatingChunksInChunkedData() {
+        let chunks = self.chunks()
+
+        measureBlock {
+            let chunkedData = ChunkedData()
+            chunks.forEach { chunkedData.appendData($0) }
+            XCTAssertEqual(chunkedData.contiguousData().length, self.chunkLength * self.chunkCount)
+        }
+    }
+}
+
+// MARK: -
+
+/// A chunk recording when its bytes are read and when it is deallocated.
+private final class RecordingData: NSData {
+    let name: String
+    let storage: NSData
+    let record: String -> Void
+
+    init(name: String, storage: NSData, record: String -> Void) {
+        self.name = name
+        self.storage = storage
+        self.record = record
+
+        super.init()
+    }
+
+    required init?(coder aDecoder: NSCoder) {
+        fatalError("init(coder:) has not been implemented")
+    }
+
+    deinit {
+        record("release \(name)")
+    }
+
+    override var length: Int {
+        return storage.length
+    }
+
+    override var bytes: UnsafePointer<Void> {
+        record("read \(name)")
+        return storage.bytes
+    }
+}
@@ -457,3 +457,177 @@ class DownloadResumeDataTestCase: BaseTestCase {
         XCTAssertNotNil(download.resumeData, "resume data should not be nil")
     }
 }
+
+// MARK: -
+
+class SegmentedDownloadTestCase: BaseTestCase {
+    let body: NSData = {
+        let bytes = (0..<100_000).map { UInt8(truncatingBitPattern: $0 * 7) }
+        return NSData(bytes: bytes, length: bytes.count)
+    }()
+
+    var manager: Manager!
+    var destinationURL: NSURL!
+
+    // Read by the stand-in on the URL loading threads
+    var supportsRanges = true
+    var failingStartOffsets: Set<Int> = []
+    var delayedStartOffsets: Set<Int> = []
+    let lock = NSLock()
+
+    override func setUp() {
+        super.setUp()
+
+        StandInURLProtocol.reset()
+        StandInURLProtocol.responder = { [unowned self] request, _ in self.replyToRequest(request) }
+
+        manager = Manager(configuration: StandInURLProtocol.sessionConfiguration())
+
+        let path = (NSTemporaryDirectory() as NSString).stringByAppendingPathComponent(NSUUID().UUIDString)
+        destinationURL = NSURL(fileURLWithPath: path)
+    }
+
+    override func tearDown() {
+        StandInURLProtocol.reset()
+        _ = try? NSFileManager.defaultManager().removeItemAtURL(destinationURL)
+        super.tearDown()
+    }
+
+    /// Serves `body`, honouring HTTP `Range` requests unless `supportsRanges` is `false`. Segments starting at one of 
+    /// `failingStartOffsets` fail halfway through, once, and those starting at one of `delayedStartOffsets` are answered 
+    /// after half a second.
+    func replyToRequest(request: NSURLRequest) -> StandInURLProtocol.Reply {
+        guard let
+            rangeHeader = request.valueForHTTPHeaderField("Range")
+            where supportsRanges && rangeHeader.hasPrefix("bytes=") else
+        {
+            return StandInURLProtocol.Reply(chunks: [body])
+        }
+
+        let offsets = rangeHeader.substringFromIndex(rangeHeader.startIndex.advancedBy(6)).componentsSeparatedByString("-")
+        let startOffset = Int(offsets[0])!
+        let endOffset = min(Int(offsets[1])!, body.length - 1)
+        let data = body.subdataWithRange(NSRange(location: startOffset, length: endOffset - startOffset + 1))
+
+        let headerFields = [
+            "Content-Range": "bytes \(startOffset)-\(endOffset)/\(body.length)",
+            "Content-Length": "\(data.length)",
+            "ETag": "\"range-body\""
+        ]
+
+        lock.lock()
+        let fails = failingStartOffsets.remove(startOffset) != nil
+        let delay = delayedStartOffsets.contains(startOffset) ? 0.5 : 0
+        lock.unlock()
+
+        guard fails else {
+            return StandInURLProtocol.Reply(statusCode: 206, headerFields: headerFields, chunks: [data], delay: delay)
+        }
+
+        return StandInURLProtocol.Reply(
+            statusCode: 206,
+            headerFields: headerFields,
+            chunks: [data.subdataWithRange(NSRange(location: 0, length: data.length / 2))],
+            error: NSError(domain: NSURLErrorDomain, code: NSURLErrorNetworkConnectionLost, userInfo: nil)
+        )
+    }
+
+    func download(segmentCount segmentCount: Int, maximumRetryCount: Int = 3) -> (NSHTTPURLResponse?, NSURL?, NSError?) {
+        let expectation = expectationWithDescription("segmented download should finish")
+        let destinationURL = self.destinationURL
+
+        var result: (NSHTTPURLResponse?, NSURL?, NSError?) = (nil, nil, nil)
+
+        manager.segmentedDownload(
+            .GET,
+            "https://range.example.com/file",
+            segmentCount: segmentCount,
+            maximumRetryCount: maximumRetryCount) { _, _ in destinationURL }
+            .response { _, response, URL, error in
+                result = (response, URL, error)
+                expectation.fulfill()
+            }
+
+        waitForExpectationsWithTimeout(timeout, handler: nil)
+
+        return result
+    }
+
+    // MARK: Tests
+
+    func testThatSegmentedDownloadWritesEverySegmentToDestination() {
+        // Given, When
+        let (response, URL, error) = download(segmentCount: 4)
+
+        // Then
+        XCTAssertNil(error, "error should be nil")
+        XCTAssertEqual(response?.statusCode ?? 0, 206, "response status code should be 206")
+        XCTAssertEqual(URL ?? NSURL(), destinationURL, "URL should be the destination URL")
+
+        let data = NSData(contentsOfURL: destinationURL)
+        XCTAssertEqual(data ?? NSData(), body, "downloaded data should match body")
+    }
+
+    func testThatFailedSegmentIsRetriedFromLastWrittenByte() {
+        // Given
+        failingStartOffsets = [25_000, 75_000]
+
+        // When
+        let (_, _, error) = download(segmentCount: 4)
+
+        // Then
+        XCTAssertNil(error, "error should be nil")
+        XCTAssertTrue(failingStartOffsets.isEmpty, "failing segments should have been requested")
+
+        let data = NSData(contentsOfURL: destinationURL)
+        XCTAssertEqual(data ?? NSData(), body, "downloaded data should match body")
+    }
+
+    func testThatSegmentedDownloadFallsBackToSingleDownloadWithoutRangeSupport() {
+        // Given
+        supportsRanges = false
+
+        // When
+        let (response, _, error) = download(segmentCount: 4)
+
+        // Then
+        XCTAssertNil(error, "error should be nil")
+        XCTAssertEqual(response?.statusCode ?? 0, 200, "response status code should be 200")
+
+        let data = NSData(contentsOfURL: destinationURL)
+        XCTAssertEqual(data ?? NSData(), body, "downloaded data should match body")
+    }
+
+    func testThatFailedSegmentStopsOtherSegmentsBeforeFileIsClosed() {
+        // Given
+        failingStartOffsets = [25_000]
+        delayedStartOffsets = [50_000, 75_000]
+
+        let sentinelPath = (NSTemporaryDirectory() as NSString).stringByAppendingPathComponent(NSUUID().UUIDString)
+
+        // When
+        let (_, URL, error) = download(segmentCount: 4, maximumRetryCount: 0)
+
+        // A file opened now is likely to be given the descriptor the download just closed
+        let sentinelFileDescriptor = open(sentinelPath, O_CREAT | O_RDWR, 0o644)
+
+        let expectation = expectationWithDescription("delayed segments should have had time to arrive")
+        dispatch_after(dispatch_time(DISPATCH_TIME_NOW, Int64(1.0 * Double(NSEC_PER_SEC))), dispatch_get_main_queue()) {
+            expectation.fulfill()
+        }
+
+        waitForExpectationsWithTimeout(timeout, handler: nil)
+
+        var fileStatus = stat()
+        fstat(sentinelFileDescriptor, &fileStatus)
+        close(sentinelFileDescriptor)
+        _ = try? NSFileManager.defaultManager().removeItemAtPath(sentinelPath)
+
+        // Then
+        XCTAssertNotNil(error, "error should not be nil")
+        XCTAssertNil(URL, "URL should be nil")
+        XCTAssertGreaterThanOrEqual(sentinelFileDescriptor, 0, "sentinel file should be opened")
+        XCTAssertEqual(fileStatus.st_size, 0, "segments still streaming should not write to a reused descriptor")
+        XCTAssertFalse(NSFileManager.defaultManager().fileExistsAtPath(destinationURL.path!), "destination should not exist")
+    }
+}
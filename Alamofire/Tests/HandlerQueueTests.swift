@@ -0,0 +1,153 @@
+// HandlerQueueTests.swift
+//
+// Copyright (c) 2014–2015 Alamofire Software Foundation (http://alamofire.org/)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+@testable import Alamofire
+import Foundation
+import XCTest
+
+class HandlerQueueTestCase: BaseTestCase {
+    func testThatHandlersAreHeldUntilQueueIsResumed() {
+        // Given
+        let queue = HandlerQueue()
+        let expectation = expectationWithDescription("handlers should run once resumed")
+
+        var order: [Int] = []
+
+        // When
+        for index in 0..<100 {
+            queue.addOperationWithBlock { order.append(index) }
+        }
+
+        queue.addOperationWithBlock { expectation.fulfill() }
+
+        let orderBeforeResuming = order
+        queue.suspended = false
+
+        waitForExpectationsWithTimeout(timeout, handler: nil)
+
+        // Then
+        XCTAssertTrue(orderBeforeResuming.isEmpty, "handlers should not run while the queue is suspended")
+        XCTAssertEqual(order, Array(0..<100), "handlers should run in the order they were added")
+    }
+
+    func testThatHandlersAddedWhileDrainingRunAfterEarlierHandlers() {
+        // Given
+        let queue = HandlerQueue()
+        let expectation = expectationWithDescription("nested handler should run")
+
+        var order: [String] = []
+
+        queue.addOperationWithBlock {
+            order.append("first")
+            queue.addOperationWithBlock {
+                order.append("nested")
+                expectation.fulfill()
+            }
+        }
+
+        queue.addOperationWithBlock { order.append("second") }
+
+        // When
+        queue.suspended = false
+
+        waitForExpectationsWithTimeout(timeout, handler: nil)
+
+        // Then
+        XCTAssertEqual(order, ["first", "second", "nested"], "handlers added while draining should run last")
+    }
+
+    func testThatSuspendingQueueHoldsRemainingHandlers() {
+        // Given
+        let queue = HandlerQueue(suspended: false)
+        let suspendedExpectation = expectationWithDescription("first handler should run")
+
+        var order: [Int] = []
+
+        // When
+        queue.addOperationWithBlock {
+            order.append(1)
+            queue.suspended = true
+            suspendedExpectation.fulfill()
+        }
+
+        queue.addOperationWithBlock { order.append(2) }
+
+        waitForExpectationsWithTimeout(timeout, handler: nil)
+
+        let orderWhileSuspended = order
+        let resumedExpectation = expectationWithDescription("remaining handlers should run")
+
+        queue.addOperationWithBlock { resumedExpectation.fulfill() }
+        queue.suspended = false
+
+        waitForExpectationsWithTimeout(timeout, handler: nil)
+
+        // Then
+        XCTAssertEqual(orderWhileSuspended, [1], "handlers should not run after the queue is suspended")
+        XCTAssertEqual(order, [1, 2], "held handlers should run once the queue is resumed")
+    }
+
+    func testThatCancelledHandlersDoNotRun() {
+        // Given
+        let queue = HandlerQueue()
+        let expectation = expectationWithDescription("handler added after cancelling should run")
+
+        var cancelledHandlerRan = false
+
+        queue.addOperationWithBlock { cancelledHandlerRan = true }
+
+        // When
+        queue.cancelAllOperations()
+        queue.addOperationWithBlock { expectation.fulfill() }
+        queue.suspended = false
+
+        waitForExpectationsWithTimeout(timeout, handler: nil)
+
+        // Then
+        XCTAssertFalse(cancelledHandlerRan, "cancelled handler should not run")
+    }
+
+    func testThatHandlersKeepTheirOrderOnceOperationQueueIsAccessed() {
+        // Given
+        let queue = HandlerQueue()
+        let expectation = expectationWithDescription("all handlers should run")
+
+        var order: [String] = []
+
+        queue.addOperationWithBlock { order.append("handler") }
+        queue.operationQueue.addOperationWithBlock { order.append("operation") }
+        queue.addOperationWithBlock { order.append("later handler") }
+
+        queue.addOperationWithBlock { expectation.fulfill() }
+
+        // When
+        let orderBeforeResuming = order
+        queue.suspended = false
+
+        waitForExpectationsWithTimeout(timeout, handler: nil)
+
+        // Then
+        XCTAssertTrue(orderBeforeResuming.isEmpty, "handlers should not run while the queue is suspended")
+        XCTAssertEqual(order, ["handler", "operation", "later handler"], "handlers and operations should run in order")
+        XCTAssertFalse(queue.operationQueue.suspended, "operation queue should be resumed with the handler queue")
+    }
+}
@@ -158,6 +158,106 @@ class ManagerTestCase: BaseTestCase {
         XCTAssertTrue(response?.statusCode == 200, "response status code should be 200")
     }
 
+    // MARK: Request Coalescing Tests
+
+    func testThatIdenticalGETRequestsShareTaskWhenCoalescingIsEnabled() {
+        // Given
+        let manager = Alamofire.Manager()
+        manager.startRequestsImmediately = false
+        manager.coalescesIdenticalGETRequests = true
+
+        let URLString = "https://httpbin.org/get"
+
+        // When
+        let first = manager.request(.GET, URLString, headers: ["Accept": "application/json"])
+        let second = manager.request(.GET, URLString, headers: ["Accept": "application/json"])
+        let differentHeaders = manager.request(.GET, URLString, headers: ["Accept": "text/plain"])
+        let differentMethod = manager.request(.POST, URLString, headers: ["Accept": "application/json"])
+
+        // Then
+        XCTAssertTrue(first === second, "identical GET requests should be coalesced")
+        XCTAssertFalse(first === differentHeaders, "GET requests with different headers should not be coalesced")
+        XCTAssertFalse(first === differentMethod, "POST requests should not be coalesced")
+    }
+
+    func testThatIdenticalGETRequestsDoNotShareTaskByDefault() {
+        // Given
+        let manager = Alamofire.Manager()
+        manager.startRequestsImmediately = false
+
+        let URLString = "https://httpbin.org/get"
+
+        // When
+        let first = manager.request(.GET, URLString)
+        let second = manager.request(.GET, URLString)
+
+        // Then
+        XCTAssertFalse(first === second, "requests should not be coalesced by default")
+    }
+
+    func testThatCoalescedRequestDeliversResponseToEveryHandler() {
+        // Given
+        let manager = Alamofire.Manager()
+        manager.coalescesIdenticalGETRequests = true
+
+        let URLString = "https://httpbin.org/get"
+        let firstExpectation = expectationWithDescription("first handler should be called")
+        let secondExpectation = expectationWithDescription("second handler should be called")
+
+        var firstResponse: Response<AnyObject, NSError>?
+        var secondResponse: Response<AnyObject, NSError>?
+
+        // When
+        manager.request(.GET, URLString).responseJSON { response in
+            firstResponse = response
+            firstExpectation.fulfill()
+        }
+
+        manager.request(.GET, URLString).responseJSON { response in
+            secondResponse = response
+            secondExpectation.fulfill()
+        }
+
+        waitForExpectationsWithTimeout(timeout, handler: nil)
+
+        // Then
+        XCTAssertTrue(firstResponse?.result.isSuccess ?? false, "first result should be success")
+        XCTAssertTrue(secondResponse?.result.isSuccess ?? false, "second result should be success")
+        XCTAssertTrue(firstResponse?.response === secondResponse?.response, "responses should be shared")
+    }
+
+    // MARK: Metrics Tests
+
+    func testThatMetricsSinkReceivesTimelineOfEveryResponseHandler() {
+        // Given
+        let manager = Alamofire.Manager()
+        let expectation = expectationWithDescription("metrics sink should be called twice")
+
+        var timelines: [Timeline] = []
+        var reportedRequest: Request?
+
+        manager.metricsSink = { request, timeline in
+            reportedRequest = request
+            timelines.append(timeline)
+
+            if timelines.count == 2 {
+                expectation.fulfill()
+            }
+        }
+
+        // When
+        let request = manager.request(.GET, "https://httpbin.org/get")
+            .response { _, _, _, _ in }
+            .responseJSON { _ in }
+
+        waitForExpectationsWithTimeout(timeout, handler: nil)
+
+        // Then
+        XCTAssertEqual(timelines.count, 2, "metrics sink should be called for each response handler")
+        XCTAssertTrue(reportedRequest === request, "metrics sink should receive the request")
+        XCTAssertGreaterThan(timelines.first?.totalDuration ?? 0.0, 0.0, "total duration should be greater than zero")
+    }
+
     // MARK: Deinitialization Tests
 
     func testReleasingManagerWithPendingRequestDeinitializesSuccessfully() {
@@ -804,6 +804,143 @@ class MultipartFormDataWriteEncodedDataToDiskTestCase: BaseTestCase {
 
 // MARK: -
 
+class MultipartFormDataEncodedStreamTestCase: BaseTestCase {
+    let CRLF = EncodingCharacters.CRLF
+
+    func readStream(stream: NSInputStream, bufferSize: Int) -> NSData? {
+        let data = NSMutableData()
+        var buffer = [UInt8](count: bufferSize, repeatedValue: 0)
+
+        stream.open()
+
+        while stream.hasBytesAvailable {
+            let bytesRead = stream.read(&buffer, maxLength: bufferSize)
+
+            if bytesRead < 0 {
+                return nil
+            }
+
+            data.appendBytes(buffer, length: bytesRead)
+        }
+
+        stream.close()
+
+        return data
+    }
+
+    func testEncodedStreamMatchesEncodedDataForMultipleBodyPartsWithVaryingTypes() {
+        for bufferSize in [7, 1024, 1024 * 1024] {
+            // Given
+            let multipartFormData = MultipartFormData()
+
+            let loremData = "Lorem ipsum.".dataUsingEncoding(NSUTF8StringEncoding, allowLossyConversion: false)!
+
+            let unicornImageURL = URLForResource("unicorn", withExtension: "png")
+
+            let rainbowImageURL = URLForResource("rainbow", withExtension: "jpg")
+            let rainbowDataLength = UInt64(NSData(contentsOfURL: rainbowImageURL)!.length)
+            let rainbowStream = NSInputStream(URL: rainbowImageURL)!
+
+            multipartFormData.appendBodyPart(data: loremData, name: "lorem")
+            multipartFormData.appendBodyPart(fileURL: unicornImageURL, name: "unicorn")
+            multipartFormData.appendBodyPart(
+                stream: rainbowStream,
+                length: rainbowDataLength,
+                name: "rainbow",
+                fileName: "rainbow.jpg",
+                mimeType: "image/jpeg"
+            )
+
+            var encodedData: NSData?
+
+            // When
+            do {
+                let stream = try multipartFormData.encodedStream()
+                encodedData = readStream(stream, bufferSize: bufferSize)
+            } catch {
+                // No-op
+            }
+
+            // Then
+            XCTAssertNotNil(encodedData, "encoded data should not be nil")
+
+            if let encodedData = encodedData {
+                let boundary = multipartFormData.boundary
+
+                let expectedData = NSMutableData()
+                expectedData.appendData(BoundaryGenerator.boundaryData(boundaryType: .Initial, boundaryKey: boundary))
+                expectedData.appendData((
+                    "Content-Disposition: form-data; name=\"lorem\"\(CRLF)\(CRLF)"
+                    ).dataUsingEncoding(NSUTF8StringEncoding, allowLossyConversion: false)!
+                )
+                expectedData.appendData(loremData)
+                expectedData.appendData(BoundaryGenerator.boundaryData(boundaryType: .Encapsulated, boundaryKey: boundary))
+                expectedData.appendData((
+                    "Content-Disposition: form-data; name=\"unicorn\"; filename=\"unicorn.png\"\(CRLF)" +
+                    "Content-Type: image/png\(CRLF)\(CRLF)"
+                    ).dataUsingEncoding(NSUTF8StringEncoding, allowLossyConversion: false)!
+                )
+                expectedData.appendData(NSData(contentsOfURL: unicornImageURL)!)
+                expectedData.appendData(BoundaryGenerator.boundaryData(boundaryType: .Encapsulated, boundaryKey: boundary))
+                expectedData.appendData((
+                    "Content-Disposition: form-data; name=\"rainbow\"; filename=\"rainbow.jpg\"\(CRLF)" +
+                    "Content-Type: image/jpeg\(CRLF)\(CRLF)"
+                    ).dataUsingEncoding(NSUTF8StringEncoding, allowLossyConversion: false)!
+                )
+                expectedData.appendData(NSData(contentsOfURL: rainbowImageURL)!)
+                expectedData.appendData(BoundaryGenerator.boundaryData(boundaryType: .Final, boundaryKey: boundary))
+
+                XCTAssertEqual(encodedData, expectedData, "data should match expected data for buffer size \(bufferSize)")
+                XCTAssertEqual(
+                    multipartFormData.encodedContentLength,
+                    UInt64(expectedData.length),
+                    "encoded content length should match expected data length"
+                )
+            }
+        }
+    }
+
+    func testEncodedStreamIsEmptyWithNoBodyParts() {
+        // Given
+        let multipartFormData = MultipartFormData()
+
+        var encodedData: NSData?
+
+        // When
+        do {
+            let stream = try multipartFormData.encodedStream()
+            encodedData = readStream(stream, bufferSize: 1024)
+        } catch {
+            // No-op
+        }
+
+        // Then
+        XCTAssertEqual(encodedData?.length ?? -1, 0, "encoded data length should be 0")
+        XCTAssertEqual(multipartFormData.encodedContentLength, 0, "encoded content length should be 0")
+    }
+
+    func testThatEncodedStreamThrowsBodyPartError() {
+        // Given
+        let multipartFormData = MultipartFormData()
+        multipartFormData.appendBodyPart(fileURL: NSURL(string: "https://example.com/image.jpg")!, name: "empty_data")
+
+        var encodingError: NSError?
+
+        // When
+        do {
+            try multipartFormData.encodedStream()
+        } catch {
+            encodingError = error as NSError
+        }
+
+        // Then
+        XCTAssertNotNil(encodingError, "encoding error should not be nil")
+        XCTAssertEqual(encodingError?.code ?? 0, NSURLErrorBadURL, "error code should match expected value")
+    }
+}
+
+// MARK: -
+
 class MultipartFormDataFailureTestCase: BaseTestCase {
     func testThatAppendingFileBodyPartWithInvalidLastPathComponentReturnsError() {
         // Given 
@@ -991,3 +1128,269 @@ class MultipartFormDataFailureTestCase: BaseTestCase {
         }
     }
 }
+
+// MARK: -
+
+class MultipartFormDataBufferPoolTestCase: BaseTestCase {
+    func testThatBufferSizeIsRoundedUpToWholePages() {
+        // Given
+        let pageSize = Int(getpagesize())
+
+        // When
+        let pool = BufferPool(bufferSize: pageSize + 1)
+        let minimumPool = BufferPool(bufferSize: 0)
+
+        // Then
+        XCTAssertEqual(pool.bufferSize, pageSize * 2, "buffer size should be rounded up to whole pages")
+        XCTAssertEqual(minimumPool.bufferSize, pageSize, "buffer size should be at least one page")
+    }
+
+    func testWritingLargeFileAndStreamBodyPartsToDiskThroughSmallBuffers() {
+        // Given
+        let sourceFileURL = temporaryFileURL()
+        let fileURL = temporaryFileURL()
+        let multipartFormData = MultipartFormData(bufferPool: BufferPool(bufferSize: 1, maximumPooledBufferCount: 1))
+
+        let bytes = (0..<(1024 * 1024 + 17)).map { UInt8(truncatingBitPattern: $0 &* 31) }
+        let largeData = NSData(bytes: bytes, length: bytes.count)
+        largeData.writeToURL(sourceFileURL, atomically: true)
+
+        multipartFormData.appendBodyPart(fileURL: sourceFileURL, name: "file", fileName: "large.bin", mimeType: "application/octet-stream")
+        multipartFormData.appendBodyPart(
+            stream: NSInputStream(data: largeData),
+            length: UInt64(largeData.length),
+            name: "stream",
+            fileName: "large.bin",
+            mimeType: "application/octet-stream"
+        )
+
+        var encodingError: NSError?
+        var encodedData: NSData?
+
+        // When
+        do {
+            try multipartFormData.writeEncodedDataToDisk(fileURL)
+        } catch {
+            encodingError = error as NSError
+        }
+
+        do {
+            let encodingFormData = MultipartFormData()
+            encodingFormData.appendBodyPart(fileURL: sourceFileURL, name: "file", fileName: "large.bin", mimeType: "application/octet-stream")
+            encodedData = try encodingFormData.encode()
+        } catch {
+            encodingError = error as NSError
+        }
+
+        // Then
+        XCTAssertNil(encodingError, "encoding error should be nil")
+
+        if let fileData = NSData(contentsOfURL: fileURL) {
+            let boundary = multipartFormData.boundary
+            let headerData = (
+                "Content-Disposition: form-data; name=\"%@\"; filename=\"large.bin\"\(EncodingCharacters.CRLF)" +
+                "Content-Type: application/octet-stream\(EncodingCharacters.CRLF)\(EncodingCharacters.CRLF)"
+            )
+
+            let expectedFileData = NSMutableData()
+            expectedFileData.appendData(BoundaryGenerator.boundaryData(boundaryType: .Initial, boundaryKey: boundary))
+            expectedFileData.appendData(String(format: headerData, "file").dataUsingEncoding(NSUTF8StringEncoding)!)
+            expectedFileData.appendData(largeData)
+            expectedFileData.appendData(BoundaryGenerator.boundaryData(boundaryType: .Encapsulated, boundaryKey: boundary))
+            expectedFileData.appendData(String(format: headerData, "stream").dataUsingEncoding(NSUTF8StringEncoding)!)
+            expectedFileData.appendData(largeData)
+            expectedFileData.appendData(BoundaryGenerator.boundaryData(boundaryType: .Final, boundaryKey: boundary))
+
+            XCTAssertEqual(fileData, expectedFileData, "file data should match expected file data")
+        } else {
+            XCTFail("file data should not be nil")
+        }
+
+        XCTAssertGreaterThan(encodedData?.length ?? 0, largeData.length, "encoded data should contain the whole file")
+    }
+}
+
+// MARK: -
+
+class MultipartFormDataConcurrentWritingTestCase: BaseTestCase {
+    func testThatConcurrentlyWrittenFileMatchesExpectedFileData() {
+        // Given
+        let fileURL = temporaryFileURL()
+        let multipartFormData = MultipartFormData()
+
+        let unicornImageURL = URLForResource("unicorn", withExtension: "png")
+        let rainbowImageURL = URLForResource("rainbow", withExtension: "jpg")
+
+        for index in 0..<12 {
+            let imageURL = index % 2 == 0 ? unicornImageURL : rainbowImageURL
+            multipartFormData.appendBodyPart(fileURL: imageURL, name: "image\(index)")
+            multipartFormData.appendBodyPart(data: "value \(index)".dataUsingEncoding(NSUTF8StringEncoding)!, name: "field\(index)")
+        }
+
+        var encodingError: NSError?
+
+        // When
+        do {
+            try multipartFormData.writeEncodedDataToDisk(fileURL, maximumConcurrentBodyParts: 4)
+        } catch {
+            encodingError = error as NSError
+        }
+
+        // Then
+        XCTAssertNil(encodingError, "encoding error should be nil")
+
+        if let fileData = NSData(contentsOfURL: fileURL) {
+            let boundary = multipartFormData.boundary
+            let CRLF = EncodingCharacters.CRLF
+            let expectedFileData = NSMutableData()
+
+            for index in 0..<12 {
+                let boundaryType: BoundaryGenerator.BoundaryType = index == 0 ? .Initial : .Encapsulated
+                let (imageURL, imageName, mimeType) = index % 2 == 0 ?
+                    (unicornImageURL, "unicorn.png", "image/png") :
+                    (rainbowImageURL, "rainbow.jpg", "image/jpeg")
+
+                expectedFileData.appendData(BoundaryGenerator.boundaryData(boundaryType: boundaryType, boundaryKey: boundary))
+                expectedFileData.appendData((
+                    "Content-Disposition: form-data; name=\"image\(index)\"; filename=\"\(imageName)\"\(CRLF)" +
+                    "Content-Type: \(mimeType)\(CRLF)\(CRLF)"
+                    ).dataUsingEncoding(NSUTF8StringEncoding, allowLossyConversion: false)!
+                )
+                expectedFileData.appendData(NSData(contentsOfURL: imageURL)!)
+
+                expectedFileData.appendData(BoundaryGenerator.boundaryData(boundaryType: .Encapsulated, boundaryKey: boundary))
+                expectedFileData.appendData((
+                    "Content-Disposition: form-data; name=\"field\(index)\"\(CRLF)\(CRLF)" +
+                    "value \(index)"
+                    ).dataUsingEncoding(NSUTF8StringEncoding, allowLossyConversion: false)!
+                )
+            }
+
+            expectedFileData.appendData(BoundaryGenerator.boundaryData(boundaryType: .Final, boundaryKey: boundary))
+
+            XCTAssertEqual(UInt64(fileData.length), multipartFormData.encodedContentLength, "file length should equal encoded content length")
+            XCTAssertEqual(fileData, expectedFileData, "file data should match expected file data")
+        } else {
+            XCTFail("file data should not be nil")
+        }
+    }
+
+    func testThatConcurrentWritingWithStreamBodyPartWritesEveryBodyPart() {
+        // Given
+        let fileURL = temporaryFileURL()
+        let multipartFormData = MultipartFormData()
+
+        let unicornImageURL = URLForResource("unicorn", withExtension: "png")
+        let rainbowImageURL = URLForResource("rainbow", withExtension: "jpg")
+        let rainbowData = NSData(contentsOfURL: rainbowImageURL)!
+
+        multipartFormData.appendBodyPart(fileURL: unicornImageURL, name: "unicorn")
+        multipartFormData.appendBodyPart(
+            stream: NSInputStream(data: rainbowData),
+            length: UInt64(rainbowData.length),
+            name: "rainbow",
+            fileName: "rainbow.jpg",
+            mimeType: "image/jpeg"
+        )
+
+        var encodingError: NSError?
+
+        // When
+        do {
+            try multipartFormData.writeEncodedDataToDisk(fileURL, maximumConcurrentBodyParts: 4)
+        } catch {
+            encodingError = error as NSError
+        }
+
+        // Then
+        XCTAssertNil(encodingError, "encoding error should be nil")
+
+        if let fileData = NSData(contentsOfURL: fileURL) {
+            let boundary = multipartFormData.boundary
+            let CRLF = EncodingCharacters.CRLF
+            let expectedFileData = NSMutableData()
+
+            expectedFileData.appendData(BoundaryGenerator.boundaryData(boundaryType: .Initial, boundaryKey: boundary))
+            expectedFileData.appendData((
+                "Content-Disposition: form-data; name=\"unicorn\"; filename=\"unicorn.png\"\(CRLF)" +
+                "Content-Type: image/png\(CRLF)\(CRLF)"
+                ).dataUsingEncoding(NSUTF8StringEncoding, allowLossyConversion: false)!
+            )
+            expectedFileData.appendData(NSData(contentsOfURL: unicornImageURL)!)
+
+            expectedFileData.appendData(BoundaryGenerator.boundaryData(boundaryType: .Encapsulated, boundaryKey: boundary))
+            expectedFileData.appendData((
+                "Content-Disposition: form-data; name=\"rainbow\"; filename=\"rainbow.jpg\"\(CRLF)" +
+                "Content-Type: image/jpeg\(CRLF)\(CRLF)"
+                ).dataUsingEncoding(NSUTF8StringEncoding, allowLossyConversion: false)!
+            )
+            expectedFileData.appendData(rainbowData)
+            expectedFileData.appendData(BoundaryGenerator.boundaryData(boundaryType: .Final, boundaryKey: boundary))
+
+            XCTAssertEqual(UInt64(fileData.length), multipartFormData.encodedContentLength, "file length should equal encoded content length")
+            XCTAssertEqual(fileData, expectedFileData, "file data should match expected file data")
+        } else {
+            XCTFail("file data should not be nil")
+        }
+    }
+
+    func testThatConcurrentWritingFailsWhenFileGetsLonger() {
+        // Given
+        let sourceFileURL = temporaryFileURL()
+        let fileURL = temporaryFileURL()
+        let multipartFormData = MultipartFormData()
+
+        "short".dataUsingEncoding(NSUTF8StringEncoding)!.writeToURL(sourceFileURL, atomically: true)
+        multipartFormData.appendBodyPart(fileURL: sourceFileURL, name: "file")
+        multipartFormData.appendBodyPart(data: "value".dataUsingEncoding(NSUTF8StringEncoding)!, name: "field")
+
+        "no longer short".dataUsingEncoding(NSUTF8StringEncoding)!.writeToURL(sourceFileURL, atomically: true)
+
+        var encodingError: NSError?
+
+        // When
+        do {
+            try multipartFormData.writeEncodedDataToDisk(fileURL, maximumConcurrentBodyParts: 2)
+        } catch {
+            encodingError = error as NSError
+        }
+
+        // Then
+        XCTAssertNotNil(encodingError, "encoding error should not be nil")
+
+        if let encodingError = encodingError {
+            XCTAssertEqual(encodingError.domain, "com.alamofire.error", "encoding error domain does not match expected value")
+            XCTAssertEqual(encodingError.code, Error.Code.InputStreamReadFailed.rawValue, "encoding error code does not match expected value")
+        }
+    }
+
+    func testThatConcurrentWritingFailsWhenFileGetsShorter() {
+        // Given
+        let sourceFileURL = temporaryFileURL()
+        let fileURL = temporaryFileURL()
+        let multipartFormData = MultipartFormData()
+
+        "no longer short".dataUsingEncoding(NSUTF8StringEncoding)!.writeToURL(sourceFileURL, atomically: true)
+        multipartFormData.appendBodyPart(fileURL: sourceFileURL, name: "file")
+        multipartFormData.appendBodyPart(data: "value".dataUsingEncoding(NSUTF8StringEncoding)!, name: "field")
+
+        "short".dataUsingEncoding(NSUTF8StringEncoding)!.writeToURL(sourceFileURL, atomically: true)
+
+        var encodingError: NSError?
+
+        // When
+        do {
+            try multipartFormData.writeEncodedDataToDisk(fileURL, maximumConcurrentBodyParts: 2)
+        } catch {
+            encodingError = error as NSError
+        }
+
+        // Then
+        XCTAssertNotNil(encodingError, "encoding error should not be nil")
+
+        if let encodingError = encodingError {
+            XCTAssertEqual(encodingError.domain, "com.alamofire.error", "encoding error domain does not match expected value")
+            XCTAssertEqual(encodingError.code, Error.Code.InputStreamReadFailed.rawValue, "encoding error code does not match expected value")
+        }
+    }
+}
@@ -324,6 +324,46 @@ class URLParameterEncodingTestCase: ParameterEncodingTestCase {
         XCTAssertEqual(URLRequest.URL?.query ?? "", expectedQuery, "query is incorrect")
     }
 
+    func testThatEscapeMatchesFoundationPercentEncodingForAllASCIIAndNonLatinCharacters() {
+        // Given
+        let allowedCharacterSet = NSCharacterSet.URLQueryAllowedCharacterSet().mutableCopy() as! NSMutableCharacterSet
+        allowedCharacterSet.removeCharactersInString(":#[]@!$&'()*+,;=")
+
+        var strings = (0..<128).map { String(UnicodeScalar(UInt8($0))) }
+        strings += ["français", "日本語", "العربية", "😃👍🏻🍻🎉", "a b+c%20d", "", "\u{7FF}\u{800}\u{FFFF}\u{10000}"]
+
+        for string in strings {
+            // When
+            let escaped = encoding.escape(string)
+
+            // Then
+            let expected = string.stringByAddingPercentEncodingWithAllowedCharacters(allowedCharacterSet) ?? string
+            XCTAssertEqual(escaped, expected, "escaped string should match Foundation for \(string.debugDescription)")
+        }
+    }
+
+    func testThatNestedParametersEncodeIdenticallyToQueryComponents() {
+        // Given
+        let parameters: [String: AnyObject] = [
+            "z": ["b": ["c": "d e", "f": [1, 2.5, true]], "ключ": "значение"],
+            "a[]": ["&", "=", "?/"],
+            "m": [String]()
+        ]
+
+        // When
+        let (URLRequest, _) = encoding.encode(self.URLRequest, parameters: parameters)
+
+        // Then
+        var components: [(String, String)] = []
+
+        for key in parameters.keys.sort(<) {
+            components += encoding.queryComponents(key, parameters[key]!)
+        }
+
+        let expectedQuery = (components.map { "\($0)=\($1)" } as [String]).joinWithSeparator("&")
+        XCTAssertEqual(URLRequest.URL?.query ?? "", expectedQuery, "query is incorrect")
+    }
+
     func testURLParameterEncodeStringForRequestWithPrecomposedQuery() {
         // Given
         let URL = NSURL(string: "https://example.com/movies?hd=[1]")!
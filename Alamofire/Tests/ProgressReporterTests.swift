@@ -0,0 +1,204 @@
+// ProgressReporterTests.swift
+//
+// Copyright (c) 2014–2015 Alamofire Software Foundation (http://alamofire.org/)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+@testable import Alamofire
+import Foundation
+import XCTest
+
+class ProgressReporterTestCase: BaseTestCase {
+    func testThatReporterCoalescesRecordedBytesIntoFewerUpdates() {
+        // Given
+        let progress = NSProgress(totalUnitCount: 0)
+        let expectation = expectationWithDescription("final update should be delivered")
+
+        var updates: [(bytes: Int64, totalBytes: Int64, totalBytesExpected: Int64)] = []
+
+        let reporter = ProgressReporter(
+            progress: progress,
+            queue: dispatch_get_main_queue(),
+            minimumInterval: 60,
+            minimumByteCount: 0
+        ) { bytes, totalBytes, totalBytesExpected in
+            updates.append((bytes, totalBytes, totalBytesExpected))
+
+            if totalBytes == totalBytesExpected {
+                expectation.fulfill()
+            }
+        }
+
+        // When
+        dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0)) {
+            for chunk in 1...1_000 {
+                reporter.recordTotalBytes(Int64(chunk * 10), totalBytesExpected: 10_000)
+            }
+        }
+
+        waitForExpectationsWithTimeout(timeout, handler: nil)
+
+        // Then
+        XCTAssertLessThanOrEqual(updates.count, 2, "updates within the minimum interval should be coalesced")
+        XCTAssertEqual(updates.reduce(0) { $0 + $1.bytes }, 10_000, "updates should account for every recorded byte")
+        XCTAssertEqual(updates.last?.totalBytes ?? 0, 10_000, "last update should report the total bytes")
+        XCTAssertEqual(progress.completedUnitCount, 10_000, "progress completed unit count should equal total bytes")
+        XCTAssertEqual(progress.totalUnitCount, 10_000, "progress total unit count should equal expected bytes")
+    }
+
+    func testThatReporterWaitsForMinimumByteCountUntilFinished() {
+        // Given
+        let progress = NSProgress(totalUnitCount: 0)
+        let expectation = expectationWithDescription("finishing should deliver the remaining bytes")
+
+        var updates: [Int64] = []
+
+        let reporter = ProgressReporter(
+            progress: progress,
+            queue: dispatch_get_main_queue(),
+            minimumInterval: 0,
+            minimumByteCount: 1_000
+        ) { bytes, _, _ in
+            updates.append(bytes)
+        }
+
+        // When
+        reporter.recordTotalBytes(400, totalBytesExpected: NSURLSessionTransferSizeUnknown)
+        reporter.recordTotalBytes(800, totalBytesExpected: NSURLSessionTransferSizeUnknown)
+        reporter.finish()
+
+        dispatch_async(dispatch_get_main_queue()) { expectation.fulfill() }
+
+        waitForExpectationsWithTimeout(timeout, handler: nil)
+
+        // Then
+        XCTAssertEqual(updates, [800], "bytes below the minimum byte count should only be delivered when finished")
+    }
+
+    func testThatResetDiscardsTheScheduledUpdate() {
+        // Given
+        let progress = NSProgress(totalUnitCount: 0)
+        var expectation = expectationWithDescription("first update should be delivered")
+
+        var updates: [(bytes: Int64, totalBytes: Int64)] = []
+
+        let reporter = ProgressReporter(
+            progress: progress,
+            queue: dispatch_get_main_queue(),
+            minimumInterval: 60,
+            minimumByteCount: 0
+        ) { bytes, totalBytes, _ in
+            updates.append((bytes, totalBytes))
+            expectation.fulfill()
+        }
+
+        reporter.recordTotalBytes(100, totalBytesExpected: 1_000)
+        waitForExpectationsWithTimeout(timeout, handler: nil)
+
+        // When
+        expectation = expectationWithDescription("update after reset should be delivered without waiting")
+
+        reporter.recordTotalBytes(200, totalBytesExpected: 1_000)
+        reporter.reset()
+        reporter.recordTotalBytes(50, totalBytesExpected: 1_000)
+
+        waitForExpectationsWithTimeout(timeout, handler: nil)
+
+        // Then
+        XCTAssertEqual(updates.count, 2, "the first update and the update after reset should be delivered")
+        XCTAssertEqual(updates.last?.bytes ?? 0, 50, "update after reset should count from zero")
+        XCTAssertEqual(updates.last?.totalBytes ?? 0, 50, "update after reset should report the new total")
+    }
+
+    func testThatEveryByteIsReportedOnceOnAConcurrentQueue() {
+        // Given
+        let progress = NSProgress(totalUnitCount: 0)
+        let queue = dispatch_queue_create("com.alamofire.tests.progress", DISPATCH_QUEUE_CONCURRENT)
+        let countQueue = dispatch_queue_create("com.alamofire.tests.progress-count", DISPATCH_QUEUE_SERIAL)
+
+        var bytesReported: Int64 = 0
+
+        let reporter = ProgressReporter(
+            progress: progress,
+            queue: queue,
+            minimumInterval: 0,
+            minimumByteCount: 0
+        ) { bytes, _, _ in
+            dispatch_sync(countQueue) { bytesReported += bytes }
+        }
+
+        // When
+        dispatch_apply(1_000, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0)) { chunk in
+            reporter.recordTotalBytes(Int64(chunk + 1) * 10, totalBytesExpected: NSURLSessionTransferSizeUnknown)
+            reporter.finish()
+        }
+        reporter.recordTotalBytes(10_000, totalBytesExpected: NSURLSessionTransferSizeUnknown)
+        reporter.finish()
+
+        dispatch_barrier_sync(queue) {}
+
+        // Then
+        dispatch_sync(countQueue) {
+            XCTAssertEqual(bytesReported, 10_000, "updates should report every byte exactly once")
+        }
+    }
+
+    func testThatRequestProgressIsDeliveredOnTheSpecifiedQueue() {
+        // Given
+        let URLString = "https://httpbin.org/bytes/\(1024 * 128)"
+        let queue = dispatch_queue_create("com.alamofire.tests.progress", DISPATCH_QUEUE_SERIAL)
+        let queueKey = UnsafeMutablePointer<Void>.alloc(1)
+        dispatch_queue_set_specific(queue, queueKey, queueKey, nil)
+
+        let expectation = expectationWithDescription("Bytes download progress should be reported: \(URLString)")
+
+        var updateCount = 0
+        var allUpdatesOnQueue = true
+        var totalBytesReported: Int64 = 0
+        var lastTotalBytes: Int64 = 0
+        var responseData: NSData?
+
+        // When
+        Alamofire.request(.GET, URLString)
+            .progress(queue: queue, minimumInterval: 0.05) { bytes, totalBytes, _ in
+                updateCount += 1
+                allUpdatesOnQueue = allUpdatesOnQueue && dispatch_get_specific(queueKey) == queueKey
+                totalBytesReported += bytes
+                lastTotalBytes = totalBytes
+            }
+            .response(queue: queue) { _, _, data, _ in
+                responseData = data
+                expectation.fulfill()
+            }
+
+        waitForExpectationsWithTimeout(timeout, handler: nil)
+        queueKey.dealloc(1)
+
+        // Then
+        XCTAssertGreaterThan(updateCount, 0, "at least one update should be delivered")
+        XCTAssertTrue(allUpdatesOnQueue, "updates should be delivered on the specified queue")
+
+        if let responseData = responseData {
+            XCTAssertEqual(totalBytesReported, Int64(responseData.length), "updates should account for every byte")
+            XCTAssertEqual(lastTotalBytes, Int64(responseData.length), "last update should report the total bytes")
+        } else {
+            XCTFail("response data should not be nil")
+        }
+    }
+}
@@ -0,0 +1,130 @@
+// RequestSchedulerTests.swift
+//
+// Copyright (c) 2014–2015 Alamofire Software Foundation (http://alamofire.org/)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+import Alamofire
+import Foundation
+import XCTest
+
+class RequestSchedulerTestCase: BaseTestCase {
+    var manager: Manager!
+
+    override func setUp() {
+        super.setUp()
+
+        // Requests are answered after a short delay, so that they overlap
+        StandInURLProtocol.reset()
+        StandInURLProtocol.responder = { _, _ in StandInURLProtocol.Reply(delay: 0.1) }
+
+        manager = Manager(configuration: StandInURLProtocol.sessionConfiguration())
+    }
+
+    func request(URLString: String, priority: RequestPriority = .Interactive) -> Request {
+        let request = manager.request(.GET, URLString)
+        request.priority = priority
+
+        let expectation = expectationWithDescription("\(URLString) should complete")
+        request.response { _, _, _, _ in expectation.fulfill() }
+
+        return request
+    }
+
+    // MARK: Tests
+
+    func testThatRequestsToHostDoNotExceedPerHostLimit() {
+        // Given
+        manager.requestScheduler = RequestScheduler(maximumConcurrentRequestsPerHost: 2)
+
+        // When
+        for index in 0..<6 {
+            request("https://a.example.com/\(index)")
+        }
+
+        waitForExpectationsWithTimeout(timeout, handler: nil)
+
+        // Then
+        XCTAssertEqual(StandInURLProtocol.startedPaths.count, 6, "all requests should have started")
+        XCTAssertLessThanOrEqual(StandInURLProtocol.maximumRunningCount, 2, "no more than 2 requests should overlap")
+    }
+
+    func testThatHigherPriorityRequestStartsBeforeQueuedLowerPriorityRequests() {
+        // Given
+        manager.requestScheduler = RequestScheduler(maximumConcurrentRequestsPerHost: 1)
+
+        // When
+        request("https://a.example.com/blocker")
+
+        for index in 0..<3 {
+            request("https://a.example.com/prefetch\(index)", priority: .Prefetch)
+        }
+
+        request("https://a.example.com/background", priority: .Background)
+        request("https://a.example.com/interactive")
+
+        waitForExpectationsWithTimeout(timeout, handler: nil)
+
+        // Then
+        let expectedPaths = ["/blocker", "/interactive", "/prefetch0", "/prefetch1", "/prefetch2", "/background"]
+        XCTAssertEqual(StandInURLProtocol.startedPaths, expectedPaths, "requests should start in priority order")
+    }
+
+    func testThatHostsTakeTurnsWithinPriorityClass() {
+        // Given
+        manager.requestScheduler = RequestScheduler(maximumConcurrentRequestsPerHost: 1, maximumConcurrentRequests: 1)
+
+        // When
+        request("https://a.example.com/a1")
+        request("https://a.example.com/a2")
+        request("https://a.example.com/a3")
+        request("https://b.example.com/b1")
+
+        waitForExpectationsWithTimeout(timeout, handler: nil)
+
+        // Then
+        XCTAssertEqual(StandInURLProtocol.startedPaths, ["/a1", "/a2", "/b1", "/a3"], "hosts should take turns")
+    }
+
+    func testThatCancelledQueuedRequestNeverStarts() {
+        // Given
+        manager.requestScheduler = RequestScheduler(maximumConcurrentRequestsPerHost: 1)
+
+        var error: NSError?
+        let expectation = expectationWithDescription("cancelled request should complete")
+
+        // When
+        request("https://a.example.com/blocker")
+
+        let cancelledRequest = manager.request(.GET, "https://a.example.com/cancelled")
+        cancelledRequest.response { _, _, _, responseError in
+            error = responseError
+            expectation.fulfill()
+        }
+
+        cancelledRequest.cancel()
+        request("https://a.example.com/next")
+
+        waitForExpectationsWithTimeout(timeout, handler: nil)
+
+        // Then
+        XCTAssertEqual(error?.code ?? 0, NSURLErrorCancelled, "error should be cancellation")
+        XCTAssertEqual(StandInURLProtocol.startedPaths, ["/blocker", "/next"], "cancelled request should not start")
+    }
+}
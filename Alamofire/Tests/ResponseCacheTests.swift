@@ -0,0 +1,399 @@
+// ResponseCacheTests.swift
+//
+// Copyright (c) 2014–2015 Alamofire Software Foundation (http://alamofire.org/)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+@testable import Alamofire
+import Foundation
+import XCTest
+
+class ResponseCacheTestCase: BaseTestCase {
+    var directoryURL: NSURL!
+    var cache: ResponseCache!
+
+    let URLString = "https://httpbin.org/get"
+
+    override func setUp() {
+        super.setUp()
+
+        let directoryPath = (NSTemporaryDirectory() as NSString).stringByAppendingPathComponent(NSUUID().UUIDString)
+        directoryURL = NSURL(fileURLWithPath: directoryPath, isDirectory: true)
+        cache = ResponseCache(directoryURL: directoryURL)
+    }
+
+    override func tearDown() {
+        _ = try? NSFileManager.defaultManager().removeItemAtURL(directoryURL)
+        super.tearDown()
+    }
+
+    func URLRequest(URLString: String = "https://httpbin.org/get") -> NSURLRequest {
+        return NSURLRequest(URL: NSURL(string: URLString)!)
+    }
+
+    func response(URLString: String = "https://httpbin.org/get", statusCode: Int = 200, headers: [String: String])
+        -> NSHTTPURLResponse
+    {
+        return NSHTTPURLResponse(URL: NSURL(string: URLString)!, statusCode: statusCode, HTTPVersion: "HTTP/1.1", headerFields: headers)!
+    }
+
+    func data(string: String) -> NSData {
+        return string.dataUsingEncoding(NSUTF8StringEncoding, allowLossyConversion: false)!
+    }
+
+    // MARK: - Storage Tests
+
+    func testThatStoredResponseCanBeRetrieved() {
+        // Given
+        let response = self.response(headers: ["Cache-Control": "max-age=60", "ETag": "\"abc\""])
+
+        // When
+        cache.storeResponse(response, data: data("cached"), forRequest: URLRequest())
+        let cachedResponse = cache.cachedResponseForRequest(URLRequest())
+
+        // Then
+        XCTAssertNotNil(cachedResponse, "cached response should not be nil")
+        XCTAssertEqual(cachedResponse?.data ?? NSData(), data("cached"), "cached data should match stored data")
+        XCTAssertEqual(cachedResponse?.response.statusCode ?? 0, 200, "cached status code should be 200")
+        XCTAssertEqual(cachedResponse?.entityTag ?? "", "\"abc\"", "entity tag should match ETag header")
+        XCTAssertTrue(cachedResponse?.isFresh ?? false, "cached response should be fresh")
+    }
+
+    func testThatFreshnessFollowsCacheControlDirectives() {
+        // Given
+        let noCacheRequest = URLRequest("https://httpbin.org/get?no-cache")
+        let noStoreRequest = URLRequest("https://httpbin.org/get?no-store")
+
+        // When
+        cache.storeResponse(
+            response("https://httpbin.org/get?no-cache", headers: ["Cache-Control": "no-cache"]),
+            data: data("no-cache"),
+            forRequest: noCacheRequest
+        )
+
+        cache.storeResponse(
+            response("https://httpbin.org/get?no-store", headers: ["Cache-Control": "no-store"]),
+            data: data("no-store"),
+            forRequest: noStoreRequest
+        )
+
+        // Then
+        XCTAssertFalse(cache.cachedResponseForRequest(noCacheRequest)?.isFresh ?? true, "no-cache response should be stale")
+        XCTAssertNil(cache.cachedResponseForRequest(noStoreRequest), "no-store response should not be stored")
+    }
+
+    func testThatNonGETRequestsAreNotCached() {
+        // Given
+        let mutableURLRequest = URLRequest().mutableCopy() as! NSMutableURLRequest
+        mutableURLRequest.HTTPMethod = "POST"
+
+        // When
+        let cachedResponse = cache.storeResponse(
+            response(headers: ["Cache-Control": "max-age=60"]),
+            data: data("post"),
+            forRequest: mutableURLRequest
+        )
+
+        // Then
+        XCTAssertNil(cachedResponse, "POST response should not be stored")
+        XCTAssertEqual(cache.size, 0, "cache size should be zero")
+    }
+
+    func testThatPrivateResponsesAndAuthorizedRequestsAreNotCached() {
+        // Given
+        let authorizedRequest = URLRequest().mutableCopy() as! NSMutableURLRequest
+        authorizedRequest.setValue("Bearer token", forHTTPHeaderField: "Authorization")
+
+        let privateRequest = URLRequest("https://httpbin.org/get?private")
+
+        // When
+        let authorizedResponse = cache.storeResponse(
+            response(headers: ["Cache-Control": "max-age=60"]),
+            data: data("authorized"),
+            forRequest: authorizedRequest
+        )
+
+        let privateResponse = cache.storeResponse(
+            response("https://httpbin.org/get?private", headers: ["Cache-Control": "private, max-age=60"]),
+            data: data("private"),
+            forRequest: privateRequest
+        )
+
+        // Then
+        XCTAssertNil(authorizedResponse, "response to request with Authorization header should not be stored")
+        XCTAssertNil(privateResponse, "private response should not be stored")
+        XCTAssertEqual(cache.size, 0, "cache size should be zero")
+    }
+
+    func testThatStoredResponseIsOnlyUsedForMatchingVaryingHeaders() {
+        // Given
+        let englishRequest = URLRequest().mutableCopy() as! NSMutableURLRequest
+        englishRequest.setValue("en", forHTTPHeaderField: "Accept-Language")
+
+        let frenchRequest = URLRequest().mutableCopy() as! NSMutableURLRequest
+        frenchRequest.setValue("fr", forHTTPHeaderField: "Accept-Language")
+
+        // When
+        cache.storeResponse(
+            response(headers: ["Cache-Control": "max-age=60", "Vary": "Accept-Language"]),
+            data: data("english"),
+            forRequest: englishRequest
+        )
+
+        let englishResponse = cache.cachedResponseForRequest(englishRequest)
+        let frenchResponse = cache.cachedResponseForRequest(frenchRequest)
+        let plainResponse = cache.cachedResponseForRequest(URLRequest())
+
+        // Then
+        XCTAssertEqual(englishResponse?.data ?? NSData(), data("english"), "matching request should get stored data")
+        XCTAssertNil(frenchResponse, "request with different Accept-Language should not get stored response")
+        XCTAssertNil(plainResponse, "request without Accept-Language should not get stored response")
+    }
+
+    func testThatResponsesVaryingOnEveryHeaderAreNotCached() {
+        // When
+        let cachedResponse = cache.storeResponse(
+            response(headers: ["Cache-Control": "max-age=60", "Vary": "*"]),
+            data: data("vary"),
+            forRequest: URLRequest()
+        )
+
+        // Then
+        XCTAssertNil(cachedResponse, "response with Vary: * should not be stored")
+    }
+
+    func testThatTransferHeadersAreNotStored() {
+        // Given
+        let headers = ["Cache-Control": "max-age=60", "Content-Encoding": "gzip", "Content-Length": "20"]
+
+        // When
+        cache.storeResponse(response(headers: headers), data: data("decoded body"), forRequest: URLRequest())
+        let storedHeaders = cache.cachedResponseForRequest(URLRequest())?.response.allHeaderFields ?? [:]
+
+        // Then
+        XCTAssertNil(HTTPHeaders.valueForField("Content-Encoding", inHeaders: storedHeaders), "Content-Encoding should not be stored")
+        XCTAssertNil(HTTPHeaders.valueForField("Content-Length", inHeaders: storedHeaders), "Content-Length should not be stored")
+        XCTAssertNotNil(HTTPHeaders.valueForField("Cache-Control", inHeaders: storedHeaders), "Cache-Control should be stored")
+    }
+
+    func testThatNotModifiedResponseRefreshesStoredResponse() {
+        // Given
+        cache.storeResponse(
+            response(headers: ["Cache-Control": "no-cache", "ETag": "\"v1\"", "Content-Type": "text/plain"]),
+            data: data("body"),
+            forRequest: URLRequest()
+        )
+
+        let notModified = response(statusCode: 304, headers: ["Cache-Control": "max-age=60", "ETag": "\"v1\""])
+
+        // When
+        let cachedResponse = cache.refreshResponse(notModified, forRequest: URLRequest())
+
+        // Then
+        XCTAssertTrue(cachedResponse?.isFresh ?? false, "refreshed response should be fresh")
+        XCTAssertEqual(cachedResponse?.response.statusCode ?? 0, 200, "refreshed status code should be 200")
+        XCTAssertEqual(cachedResponse?.data ?? NSData(), data("body"), "refreshed data should match stored data")
+
+        if let contentType = cachedResponse?.response.allHeaderFields["Content-Type"] as? String {
+            XCTAssertEqual(contentType, "text/plain", "content type should be kept from stored response")
+        } else {
+            XCTFail("content type should not be nil")
+        }
+    }
+
+    func testThatLeastRecentlyUsedResponsesAreEvictedOverSizeLimit() {
+        // Given
+        cache = ResponseCache(directoryURL: directoryURL, sizeLimit: 10)
+        let headers = ["Cache-Control": "max-age=60"]
+
+        // When
+        cache.storeResponse(response("https://httpbin.org/get?1", headers: headers), data: data("1111"), forRequest: URLRequest("https://httpbin.org/get?1"))
+        cache.storeResponse(response("https://httpbin.org/get?2", headers: headers), data: data("2222"), forRequest: URLRequest("https://httpbin.org/get?2"))
+        NSThread.sleepForTimeInterval(0.01)
+        cache.cachedResponseForRequest(URLRequest("https://httpbin.org/get?1"))
+        cache.storeResponse(response("https://httpbin.org/get?3", headers: headers), data: data("3333"), forRequest: URLRequest("https://httpbin.org/get?3"))
+
+        // Then
+        XCTAssertNotNil(cache.cachedResponseForRequest(URLRequest("https://httpbin.org/get?1")), "recently used response should be kept")
+        XCTAssertNil(cache.cachedResponseForRequest(URLRequest("https://httpbin.org/get?2")), "least recently used response should be evicted")
+        XCTAssertNotNil(cache.cachedResponseForRequest(URLRequest("https://httpbin.org/get?3")), "new response should be kept")
+        XCTAssertEqual(cache.size, 8, "cache size should be within size limit")
+    }
+
+    func testThatStoredResponsesSurviveReopeningCache() {
+        // Given
+        cache.storeResponse(response(headers: ["Cache-Control": "max-age=60"]), data: data("persisted"), forRequest: URLRequest())
+
+        // When
+        let expectation = expectationWithDescription("index should be written")
+        dispatch_after(dispatch_time(DISPATCH_TIME_NOW, Int64(2 * NSEC_PER_SEC)), dispatch_get_main_queue()) {
+            expectation.fulfill()
+        }
+
+        waitForExpectationsWithTimeout(timeout, handler: nil)
+
+        let reopenedCache = ResponseCache(directoryURL: directoryURL)
+        let cachedResponse = reopenedCache.cachedResponseForRequest(URLRequest())
+
+        // Then
+        XCTAssertEqual(cachedResponse?.data ?? NSData(), data("persisted"), "reopened cache should return stored data")
+        XCTAssertEqual(reopenedCache.size, 9, "reopened cache size should match stored data")
+    }
+
+    // MARK: - Manager Tests
+
+    func testThatManagerCompletesRequestWithFreshCachedResponse() {
+        // Given
+        let manager = Alamofire.Manager()
+        manager.responseCache = cache
+
+        let URLString = "https://invalid-url-here.org/this/does/not/exist"
+        cache.storeResponse(
+            response(URLString, headers: ["Cache-Control": "max-age=60", "Content-Type": "application/json"]),
+            data: data("{\"cached\": true}"),
+            forRequest: URLRequest(URLString)
+        )
+
+        let expectation = expectationWithDescription("request should complete from cache")
+        var JSONResponse: Response<AnyObject, NSError>?
+
+        // When
+        manager.request(.GET, URLString).responseJSON { response in
+            JSONResponse = response
+            expectation.fulfill()
+        }
+
+        waitForExpectationsWithTimeout(timeout, handler: nil)
+
+        // Then
+        XCTAssertEqual(JSONResponse?.response?.statusCode ?? 0, 200, "status code should be 200")
+        XCTAssertTrue(JSONResponse?.result.isSuccess ?? false, "result should be success")
+        XCTAssertEqual(JSONResponse?.result.value?["cached"] as? Bool ?? false, true, "JSON should come from the cache")
+    }
+
+    func testThatManagerStreamsFreshCachedResponse() {
+        // Given
+        let manager = Alamofire.Manager()
+        manager.responseCache = cache
+
+        let URLString = "https://invalid-url-here.org/streamed/from/cache"
+        cache.storeResponse(
+            response(URLString, headers: ["Cache-Control": "max-age=60", "Content-Type": "application/json"]),
+            data: data("[{\"id\": 1}, {\"id\": 2}, {\"id\": 3}]"),
+            forRequest: URLRequest(URLString)
+        )
+
+        let expectation = expectationWithDescription("streamed request should complete from cache")
+        var elements: [AnyObject] = []
+        var countResponse: Response<Int, NSError>?
+
+        // When
+        let request = manager.request(.GET, URLString).responseJSON(
+            elementHandler: { element in
+                elements.append(element)
+            },
+            completionHandler: { response in
+                countResponse = response
+                expectation.fulfill()
+            }
+        )
+
+        waitForExpectationsWithTimeout(timeout, handler: nil)
+
+        // Then
+        XCTAssertTrue(countResponse?.result.isSuccess ?? false, "result should be success")
+        XCTAssertEqual(countResponse?.result.value ?? 0, 3, "every cached element should be parsed")
+        XCTAssertEqual(elements.flatMap { $0["id"] as? Int }, [1, 2, 3], "elements should come from the cache")
+        XCTAssertNil(request.receivedData, "received data should be nil for a streamed request")
+    }
+
+    func testThatCachedResponseFillsReceivedData() {
+        // Given
+        let manager = Alamofire.Manager()
+        manager.responseCache = cache
+
+        let URLString = "https://invalid-url-here.org/chunked/from/cache"
+        cache.storeResponse(
+            response(URLString, headers: ["Cache-Control": "max-age=60"]),
+            data: data("cached chunks"),
+            forRequest: URLRequest(URLString)
+        )
+
+        let expectation = expectationWithDescription("request should complete from cache")
+
+        // When
+        let request = manager.request(.GET, URLString).response { _, _, _, _ in
+            expectation.fulfill()
+        }
+
+        waitForExpectationsWithTimeout(timeout, handler: nil)
+
+        // Then
+        XCTAssertEqual(request.receivedData?.contiguousData() ?? NSData(), data("cached chunks"), "received data should hold the cached body")
+    }
+
+    func testThatManagerServesStaleResponseWhileRevalidating() {
+        // Given
+        let manager = Alamofire.Manager()
+        manager.responseCache = cache
+        manager.responseCacheMode = .StaleWhileRevalidate
+
+        cache.storeResponse(
+            response(headers: ["Cache-Control": "no-cache"]),
+            data: data("stale"),
+            forRequest: URLRequest()
+        )
+
+        let expectation = expectationWithDescription("request should complete from cache")
+        var receivedData: NSData?
+
+        // When
+        manager.request(.GET, URLString).response { _, _, responseData, _ in
+            receivedData = responseData
+            expectation.fulfill()
+        }
+
+        waitForExpectationsWithTimeout(timeout, handler: nil)
+
+        // Then
+        XCTAssertEqual(receivedData ?? NSData(), data("stale"), "stale data should be returned")
+    }
+
+    func testThatManagerStoresResponsesInCache() {
+        // Given
+        let manager = Alamofire.Manager()
+        manager.responseCache = cache
+
+        let URLString = "https://httpbin.org/cache/60"
+        let expectation = expectationWithDescription("request should succeed")
+
+        // When
+        manager.request(.GET, URLString).response { _, _, _, _ in
+            expectation.fulfill()
+        }
+
+        waitForExpectationsWithTimeout(timeout, handler: nil)
+
+        let cachedResponse = cache.cachedResponseForRequest(URLRequest(URLString))
+
+        // Then
+        XCTAssertNotNil(cachedResponse, "cached response should not be nil")
+        XCTAssertTrue(cachedResponse?.isFresh ?? false, "cached response should be fresh")
+    }
+}
@@ -451,6 +451,130 @@ class ResponseSerializationTestCase: BaseTestCase {
         }
     }
 
+    // MARK: - JSON Stream Parser Tests
+
+    func testThatJSONStreamParserEmitsArrayElementsSplitAcrossEveryByteBoundary() {
+        // Given
+        let JSONString = "[1, \"a,]\\\"b\", {\"c\": [2, {\"d\": \"}\"}]}, [], true, null, -3.5e2]"
+        let bytes = Array(JSONString.utf8)
+
+        for split in 1..<bytes.count {
+            var elements: [AnyObject] = []
+            let parser = JSONStreamParser { elements.append($0) }
+
+            // When
+            do {
+                try parser.appendData(NSData(bytes: Array(bytes[0..<split]), length: split))
+                try parser.appendData(NSData(bytes: Array(bytes[split..<bytes.count]), length: bytes.count - split))
+                try parser.finish()
+            } catch {
+                XCTFail("parser should not throw when split at \(split): \(error)")
+            }
+
+            // Then
+            XCTAssertEqual(elements.count, 7, "element count should be 7 when split at \(split)")
+            XCTAssertEqual(parser.elementCount, 7, "parser element count should be 7 when split at \(split)")
+
+            if elements.count == 7 {
+                XCTAssertEqual(elements[0] as? Int, 1, "first element should be 1")
+                XCTAssertEqual(elements[1] as? String, "a,]\"b", "second element should match expected value")
+                XCTAssertEqual((elements[3] as? [AnyObject])?.count, 0, "fourth element should be an empty array")
+                XCTAssertTrue(elements[5] is NSNull, "sixth element should be NSNull")
+                XCTAssertEqual(elements[6] as? Double, -350.0, "seventh element should be -350.0")
+            }
+        }
+    }
+
+    func testThatJSONStreamParserEmitsElementsBeforeTheArrayIsComplete() {
+        // Given
+        var elements: [AnyObject] = []
+        let parser = JSONStreamParser { elements.append($0) }
+
+        // When
+        _ = try? parser.appendData("[{\"id\": 1}, {\"id\": 2}, {\"id\"".dataUsingEncoding(NSUTF8StringEncoding)!)
+
+        // Then
+        XCTAssertEqual(elements.count, 2, "elements count should be 2 before the array is complete")
+    }
+
+    func testThatJSONStreamParserEmitsANonArrayValueAsASingleElement() {
+        // Given
+        var elements: [AnyObject] = []
+        let parser = JSONStreamParser { elements.append($0) }
+
+        // When
+        do {
+            try parser.appendData("{\"json\": ".dataUsingEncoding(NSUTF8StringEncoding)!)
+            try parser.appendData("true}".dataUsingEncoding(NSUTF8StringEncoding)!)
+            XCTAssertEqual(elements.count, 0, "elements count should be 0 before finishing")
+            try parser.finish()
+        } catch {
+            XCTFail("parser should not throw: \(error)")
+        }
+
+        // Then
+        XCTAssertEqual(elements.count, 1, "elements count should be 1")
+        XCTAssertEqual((elements.first as? [String: AnyObject])?["json"] as? Bool, true, "json value should be true")
+    }
+
+    func testThatJSONStreamParserSucceedsWithEmptyArray() {
+        // Given
+        let parser = JSONStreamParser { _ in }
+
+        // When
+        do {
+            try parser.appendData(" [ ] ".dataUsingEncoding(NSUTF8StringEncoding)!)
+            try parser.finish()
+        } catch {
+            XCTFail("parser should not throw: \(error)")
+        }
+
+        // Then
+        XCTAssertEqual(parser.elementCount, 0, "element count should be 0")
+    }
+
+    func testThatJSONStreamParserFailsWithMalformedArrays() {
+        for JSONString in ["[1 2]", "[1,]", "[,1]", "[1,,2]", "[1] 2", "[}", "[{\"a\": 1]", "[1, 2"] {
+            // Given
+            let parser = JSONStreamParser { _ in }
+
+            // When
+            var error: NSError?
+
+            do {
+                try parser.appendData(JSONString.dataUsingEncoding(NSUTF8StringEncoding)!)
+                try parser.finish()
+            } catch let parserError as NSError {
+                error = parserError
+            }
+
+            // Then
+            XCTAssertNotNil(error, "error should not be nil for \(JSONString)")
+        }
+    }
+
+    func testThatJSONStreamParserFailsWhenDataIsEmpty() {
+        // Given
+        let parser = JSONStreamParser { _ in }
+
+        // When
+        var error: NSError?
+
+        do {
+            try parser.finish()
+        } catch let parserError as NSError {
+            error = parserError
+        }
+
+        // Then
+        if let error = error {
+            XCTAssertEqual(error.domain, Error.Domain, "error domain should match expected value")
+            XCTAssertEqual(error.code, Error.Code.JSONSerializationFailed.rawValue, "error code should match expected value")
+        } else {
+            XCTFail("error should not be nil")
+        }
+    }
+
     // MARK: - Property List Response Serializer Tests
 
     func testThatPropertyListResponseSerializerFailsWhenDataIsNil() {
@@ -264,6 +264,172 @@ class ResponseJSONTestCase: BaseTestCase {
             XCTFail("response should not be nil")
         }
     }
+
+    func testThatStreamingResponseJSONEmitsElementsAndCompletesWithElementCount() {
+        // Given
+        let URLString = "https://httpbin.org/get"
+        let expectation = expectationWithDescription("request should succeed")
+
+        var elements: [AnyObject] = []
+        var response: Response<Int, NSError>?
+
+        // When
+        Alamofire.request(.GET, URLString, parameters: ["foo": "bar"])
+            .responseJSON(
+                elementHandler: { element in
+                    elements.append(element)
+                },
+                completionHandler: { closureResponse in
+                    response = closureResponse
+                    expectation.fulfill()
+                }
+            )
+
+        waitForExpectationsWithTimeout(timeout, handler: nil)
+
+        // Then
+        if let response = response {
+            XCTAssertNotNil(response.request, "request should not be nil")
+            XCTAssertNotNil(response.response, "response should not be nil")
+            XCTAssertNil(response.data, "data should be nil")
+            XCTAssertTrue(response.result.isSuccess, "result should be success")
+            XCTAssertEqual(response.result.value, 1, "result value should be 1")
+            XCTAssertEqual(elements.count, 1, "elements count should be 1")
+        } else {
+            XCTFail("response should not be nil")
+        }
+    }
+}
+
+// MARK: -
+
+class ResponseTimelineTestCase: BaseTestCase {
+    func testThatResponseTimelineCoversRequestPhasesInOrder() {
+        // Given
+        let URLString = "https://httpbin.org/get"
+        let expectation = expectationWithDescription("request should succeed")
+
+        var response: Response<AnyObject, NSError>?
+
+        // When
+        Alamofire.request(.GET, URLString)
+            .responseJSON { closureResponse in
+                response = closureResponse
+                expectation.fulfill()
+            }
+
+        waitForExpectationsWithTimeout(timeout, handler: nil)
+
+        // Then
+        if let timeline = response?.timeline {
+            XCTAssertGreaterThan(timeline.requestStartTime, 0.0, "request start time should be set")
+            XCTAssertGreaterThan(timeline.latency, 0.0, "latency should be greater than zero")
+            XCTAssertGreaterThanOrEqual(timeline.initialResponseTime, timeline.taskResumeTime, "initial response should follow resume")
+            XCTAssertGreaterThanOrEqual(timeline.requestCompletedTime, timeline.initialResponseTime, "completion should follow initial response")
+            XCTAssertGreaterThanOrEqual(timeline.completionHandlerStartTime, timeline.serializationCompletedTime, "handler should follow serialization")
+            XCTAssertEqualWithAccuracy(
+                timeline.totalDuration,
+                timeline.queueDuration + timeline.latency + timeline.transferDuration + timeline.serializationDuration + timeline.dispatchDuration,
+                accuracy: 0.0001,
+                "total duration should be the sum of the phase durations"
+            )
+        } else {
+            XCTFail("timeline should not be nil")
+        }
+    }
+
+    func testThatTimelineClampsSkippedPhasesToPreviousPhase() {
+        // Given, When
+        let timeline = Timeline(requestStartTime: 10.0, taskResumeTime: 11.0, completionHandlerStartTime: 14.0)
+
+        // Then
+        XCTAssertEqual(timeline.initialResponseTime, 11.0, "initial response time should match resume time")
+        XCTAssertEqual(timeline.requestCompletedTime, 11.0, "completed time should match resume time")
+        XCTAssertEqual(timeline.queueDuration, 1.0, "queue duration should be 1 second")
+        XCTAssertEqual(timeline.latency, 0.0, "latency should be zero")
+        XCTAssertEqual(timeline.dispatchDuration, 3.0, "dispatch duration should be 3 seconds")
+        XCTAssertEqual(timeline.totalDuration, 4.0, "total duration should be 4 seconds")
+    }
+}
+
+// MARK: -
+
+class SerializationExecutorTestCase: BaseTestCase {
+    func testThatExecutorLimitsConcurrentSerializations() {
+        // Given
+        let executor = SerializationExecutor(maximumConcurrentSerializations: 2, qualityOfService: .UserInitiated)
+        let countQueue = dispatch_queue_create("com.alamofire.tests.count", DISPATCH_QUEUE_SERIAL)
+        let group = dispatch_group_create()
+
+        var runningCount = 0
+        var maximumRunningCount = 0
+
+        // When
+        for _ in 0..<8 {
+            dispatch_group_enter(group)
+
+            executor.execute {
+                dispatch_sync(countQueue) {
+                    runningCount += 1
+                    maximumRunningCount = max(maximumRunningCount, runningCount)
+                }
+
+                NSThread.sleepForTimeInterval(0.05)
+
+                dispatch_sync(countQueue) { runningCount -= 1 }
+                dispatch_group_leave(group)
+            }
+        }
+
+        dispatch_group_wait(group, DISPATCH_TIME_FOREVER)
+
+        // Then
+        XCTAssertEqual(executor.maximumConcurrentSerializations, 2, "maximum concurrent serializations should be 2")
+        XCTAssertLessThanOrEqual(maximumRunningCount, 2, "no more than 2 serializations should run concurrently")
+        XCTAssertGreaterThan(maximumRunningCount, 0, "serializations should run")
+    }
+
+    func testThatSerializationRunsOffMainThreadAndCompletionHandlersKeepTheirOrder() {
+        // Given
+        let manager = Alamofire.Manager()
+        manager.serializationExecutor = SerializationExecutor(maximumConcurrentSerializations: 4)
+
+        let slowSerializer = ResponseSerializer<Bool, NSError> { _, _, _, _ in
+            NSThread.sleepForTimeInterval(0.2)
+            return .Success(NSThread.isMainThread())
+        }
+
+        let fastSerializer = ResponseSerializer<Bool, NSError> { _, _, _, _ in
+            return .Success(NSThread.isMainThread())
+        }
+
+        let expectation = expectationWithDescription("both handlers should be called")
+
+        var completionOrder: [String] = []
+        var serializedOnMainThread: [Bool] = []
+        var completedOnMainThread: [Bool] = []
+
+        // When
+        manager.request(.GET, "https://httpbin.org/get")
+            .response(responseSerializer: slowSerializer) { response in
+                completionOrder.append("slow")
+                serializedOnMainThread.append(response.result.value ?? true)
+                completedOnMainThread.append(NSThread.isMainThread())
+            }
+            .response(responseSerializer: fastSerializer) { response in
+                completionOrder.append("fast")
+                serializedOnMainThread.append(response.result.value ?? true)
+                completedOnMainThread.append(NSThread.isMainThread())
+                expectation.fulfill()
+            }
+
+        waitForExpectationsWithTimeout(timeout, handler: nil)
+
+        // Then
+        XCTAssertEqual(completionOrder, ["slow", "fast"], "completion handlers should be called in the order added")
+        XCTAssertEqual(serializedOnMainThread, [false, false], "serialization should not run on the main thread")
+        XCTAssertEqual(completedOnMainThread, [true, true], "completion handlers should run on the main thread")
+    }
 }
 
 // MARK: -
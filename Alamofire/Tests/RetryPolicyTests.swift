@@ -0,0 +1,241 @@
+// RetryPolicyTests.swift
+//
+// Copyright (c) 2014–2015 Alamofire Software Foundation (http://alamofire.org/)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+import Alamofire
+import Foundation
+import XCTest
+
+class RetryPolicyTestCase: BaseTestCase {
+    let URLRequest = NSURLRequest(URL: NSURL(string: "https://httpbin.org/get")!)
+
+    override func setUp() {
+        super.setUp()
+        StandInURLProtocol.reset()
+    }
+
+    /// Answers with `503 Service Unavailable` to the first `failureCount` requests and with `200 OK` afterwards.
+    func failFirstRequests(failureCount: Int) {
+        StandInURLProtocol.responder = { _, index in
+            let headerFields = ["Content-Type": "application/json", "Retry-After": "0"]
+
+            if index < failureCount {
+                return StandInURLProtocol.Reply(statusCode: 503, headerFields: headerFields, body: "unavailable")
+            } else {
+                return StandInURLProtocol.Reply(headerFields: headerFields, body: "{\"attempt\": \(index + 1)}")
+            }
+        }
+    }
+
+    func response(statusCode statusCode: Int, headers: [String: String]? = nil) -> NSHTTPURLResponse {
+        return NSHTTPURLResponse(URL: URLRequest.URL!, statusCode: statusCode, HTTPVersion: "HTTP/1.1", headerFields: headers)!
+    }
+
+    // MARK: Classification Tests
+
+    func testThatTransientFailuresOfIdempotentRequestsAreRetryable() {
+        // Given
+        let policy = RetryPolicy()
+        let timeoutError = NSError(domain: NSURLErrorDomain, code: NSURLErrorTimedOut, userInfo: nil)
+        let cancelledError = NSError(domain: NSURLErrorDomain, code: NSURLErrorCancelled, userInfo: nil)
+
+        let POSTRequest = URLRequest.mutableCopy() as! NSMutableURLRequest
+        POSTRequest.HTTPMethod = "POST"
+
+        // When, Then
+        XCTAssertTrue(policy.isRetryableRequest(URLRequest, response: nil, error: timeoutError), "timeout should be retryable")
+        XCTAssertTrue(policy.isRetryableRequest(URLRequest, response: response(statusCode: 503), error: nil), "503 should be retryable")
+        XCTAssertFalse(policy.isRetryableRequest(URLRequest, response: nil, error: cancelledError), "cancellation should not be retryable")
+        XCTAssertFalse(policy.isRetryableRequest(URLRequest, response: response(statusCode: 404), error: nil), "404 should not be retryable")
+        XCTAssertFalse(policy.isRetryableRequest(POSTRequest, response: nil, error: timeoutError), "POST should not be retryable")
+    }
+
+    // MARK: Delay Tests
+
+    func testThatRetryDelayIsJitteredWithinExponentialBound() {
+        // Given
+        let policy = RetryPolicy(maximumRetryCount: 10, baseDelay: 1.0, maximumDelay: 5.0, hostRetryBudget: 100)
+        let error = NSError(domain: NSURLErrorDomain, code: NSURLErrorNetworkConnectionLost, userInfo: nil)
+
+        // When
+        let delays = (0..<6).map { policy.retryDelayForRequest(URLRequest, response: nil, error: error, retryCount: $0) }
+
+        // Then
+        for (retryCount, delay) in delays.enumerate() {
+            let bound = min(pow(2.0, Double(retryCount)), 5.0)
+
+            if let delay = delay {
+                XCTAssertGreaterThanOrEqual(delay, 0.0, "delay should not be negative")
+                XCTAssertLessThanOrEqual(delay, bound, "delay should not exceed the exponential bound")
+            } else {
+                XCTFail("delay should not be nil")
+            }
+        }
+    }
+
+    func testThatRetryAfterHeaderIsHonored() {
+        // Given
+        let policy = RetryPolicy(maximumDelay: 10.0)
+
+        // When
+        let delay = policy.retryDelayForRequest(
+            URLRequest,
+            response: response(statusCode: 503, headers: ["Retry-After": "7"]),
+            error: nil,
+            retryCount: 0
+        )
+
+        let tooLongDelay = policy.retryDelayForRequest(
+            URLRequest,
+            response: response(statusCode: 503, headers: ["Retry-After": "120"]),
+            error: nil,
+            retryCount: 0
+        )
+
+        // Then
+        XCTAssertEqual(delay ?? 0.0, 7.0, "delay should match Retry-After")
+        XCTAssertNil(tooLongDelay, "Retry-After beyond the maximum delay should not be retried")
+    }
+
+    func testThatRetryAfterHTTPDateIsHonored() {
+        // Given
+        let policy = RetryPolicy(maximumDelay: 60.0)
+
+        let formatter = NSDateFormatter()
+        formatter.locale = NSLocale(localeIdentifier: "en_US_POSIX")
+        formatter.timeZone = NSTimeZone(abbreviation: "GMT")
+        formatter.dateFormat = "EEE, dd MMM yyyy HH:mm:ss zzz"
+        let retryDate = formatter.stringFromDate(NSDate(timeIntervalSinceNow: 30.0))
+
+        // When
+        let delay = policy.retryDelayForRequest(
+            URLRequest,
+            response: response(statusCode: 503, headers: ["retry-after": retryDate]),
+            error: nil,
+            retryCount: 0
+        )
+
+        // Then
+        XCTAssertNotNil(delay, "delay should not be nil")
+        XCTAssertGreaterThan(delay ?? 0.0, 25.0, "delay should match the Retry-After date")
+        XCTAssertLessThanOrEqual(delay ?? 0.0, 30.0, "delay should match the Retry-After date")
+    }
+
+    func testThatRetriesStopAtMaximumRetryCountAndHostBudget() {
+        // Given
+        let policy = RetryPolicy(maximumRetryCount: 2, hostRetryBudget: 3)
+        let unavailable = response(statusCode: 503)
+
+        // When
+        let beyondMaximum = policy.retryDelayForRequest(URLRequest, response: unavailable, error: nil, retryCount: 2)
+        let withinBudget = (0..<3).map { _ in policy.retryDelayForRequest(URLRequest, response: unavailable, error: nil, retryCount: 0) }
+        let beyondBudget = policy.retryDelayForRequest(URLRequest, response: unavailable, error: nil, retryCount: 0)
+
+        let otherHostRequest = NSURLRequest(URL: NSURL(string: "https://example.com/get")!)
+        let otherHost = policy.retryDelayForRequest(otherHostRequest, response: unavailable, error: nil, retryCount: 0)
+
+        // Then
+        XCTAssertNil(beyondMaximum, "retry beyond the maximum retry count should not be allowed")
+        XCTAssertEqual(withinBudget.flatMap { $0 }.count, 3, "retries within the host budget should be allowed")
+        XCTAssertNil(beyondBudget, "retry beyond the host budget should not be allowed")
+        XCTAssertNotNil(otherHost, "other hosts should have their own budget")
+    }
+
+    // MARK: Manager Tests
+
+    func testThatManagerRetriesFailedRequestWithSameRequestInstance() {
+        // Given
+        failFirstRequests(2)
+
+        let manager = Manager(configuration: StandInURLProtocol.sessionConfiguration())
+        manager.retryPolicy = RetryPolicy(maximumRetryCount: 3, baseDelay: 0.01)
+
+        let expectation = expectationWithDescription("request should succeed after retries")
+        var response: Response<AnyObject, NSError>?
+
+        // When
+        let request = manager.request(.GET, "https://flaky.example.com/get")
+            .validate()
+            .responseJSON { closureResponse in
+                response = closureResponse
+                expectation.fulfill()
+            }
+
+        waitForExpectationsWithTimeout(timeout, handler: nil)
+
+        // Then
+        XCTAssertTrue(response?.result.isSuccess ?? false, "result should be success")
+        XCTAssertEqual(response?.response?.statusCode ?? 0, 200, "status code should be 200")
+        XCTAssertEqual(request.retryCount, 2, "request should have been retried twice")
+        XCTAssertEqual(StandInURLProtocol.requestCount, 3, "request should have been sent three times")
+    }
+
+    func testThatManagerDoesNotRetryWithoutPolicy() {
+        // Given
+        failFirstRequests(1)
+
+        let manager = Manager(configuration: StandInURLProtocol.sessionConfiguration())
+        let expectation = expectationWithDescription("request should complete")
+        var statusCode: Int?
+
+        // When
+        manager.request(.GET, "https://flaky.example.com/get").response { _, response, _, _ in
+            statusCode = response?.statusCode
+            expectation.fulfill()
+        }
+
+        waitForExpectationsWithTimeout(timeout, handler: nil)
+
+        // Then
+        XCTAssertEqual(statusCode ?? 0, 503, "status code should be 503")
+        XCTAssertEqual(StandInURLProtocol.requestCount, 1, "request should have been sent once")
+    }
+
+    func testThatRequestWaitingToBeRetriedIsCoalesced() {
+        // Given
+        StandInURLProtocol.responder = { _, index in
+            let statusCode = index == 0 ? 503 : 200
+            return StandInURLProtocol.Reply(statusCode: statusCode, headerFields: ["Retry-After": "1"], body: "")
+        }
+
+        let manager = Manager(configuration: StandInURLProtocol.sessionConfiguration())
+        manager.retryPolicy = RetryPolicy()
+        manager.coalescesIdenticalGETRequests = true
+
+        let expectation = expectationWithDescription("identical request should be made during the retry delay")
+        var secondRequest: Request?
+
+        // When
+        let firstRequest = manager.request(.GET, "https://flaky.example.com/get")
+
+        dispatch_after(dispatch_time(DISPATCH_TIME_NOW, Int64(0.5 * Double(NSEC_PER_SEC))), dispatch_get_main_queue()) {
+            secondRequest = manager.request(.GET, "https://flaky.example.com/get")
+            secondRequest?.response { _, _, _, _ in expectation.fulfill() }
+        }
+
+        waitForExpectationsWithTimeout(timeout, handler: nil)
+
+        // Then
+        XCTAssertTrue(firstRequest === secondRequest, "request waiting to be retried should be coalesced")
+        XCTAssertEqual(firstRequest.retryCount, 1, "request should have been retried once")
+        XCTAssertEqual(StandInURLProtocol.requestCount, 2, "request should have been sent twice")
+    }
+}
@@ -0,0 +1,185 @@
+// StandInURLProtocol.swift
+//
+// Copyright (c) 2014–2015 Alamofire Software Foundation (http://alamofire.org/)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+import Foundation
+
+/**
+    Answers every request locally, standing in for an HTTP server.
+
+    Each request is answered with the reply the `responder` returns for it, optionally after a delay. The protocol 
+    also records the paths of the requests in the order they start and how many of them overlap. Test cases using it 
+    call `reset()` in `setUp()` before setting their responder.
+*/
+class StandInURLProtocol: NSURLProtocol {
+
+    // MARK: - Helper Types
+
+    /// The answer to a request.
+    struct Reply {
+        /// The status code of the response, or `nil` to fail with `error` before any response.
+        let statusCode: Int?
+        let headerFields: [String: String]
+        /// The body, delivered to the client one chunk at a time.
+        let chunks: [NSData]
+        /// The error the loading fails with after the chunks, rather than finishing.
+        let error: NSError?
+        /// The time before the request is answered.
+        let delay: NSTimeInterval
+
+        init(
+            statusCode: Int? = 200,
+            headerFields: [String: String] = [:],
+            chunks: [NSData] = [],
+            error: NSError? = nil,
+            delay: NSTimeInterval = 0)
+        {
+            self.statusCode = statusCode
+            self.headerFields = headerFields
+            self.chunks = chunks
+            self.error = error
+            self.delay = delay
+        }
+
+        init(statusCode: Int = 200, headerFields: [String: String] = [:], body: String, delay: NSTimeInterval = 0) {
+            let chunks = [body.dataUsingEncoding(NSUTF8StringEncoding)!]
+            self.init(statusCode: statusCode, headerFields: headerFields, chunks: chunks, delay: delay)
+        }
+    }
+
+    // MARK: - Properties
+
+    /// Returns the reply to a request, given the request and the number of requests started before it.
+    static var responder: (NSURLRequest, Int) -> Reply = { _, _ in Reply() }
+
+    static var requestCount: Int { return withLock { startedPaths.count } }
+    private(set) static var startedPaths: [String] = []
+    private(set) static var maximumRunningCount = 0
+
+    private static var runningCount = 0
+    private static let lock = NSLock()
+
+    // MARK: - Configuration
+
+    /// Restores the default responder, which answers `200 OK` with no body, and clears the recorded requests.
+    static func reset() {
+        withLock {
+            responder = { _, _ in Reply() }
+            startedPaths = []
+            runningCount = 0
+            maximumRunningCount = 0
+        }
+    }
+
+    /// An ephemeral session configuration whose requests are answered by the stand-in.
+    static func sessionConfiguration() -> NSURLSessionConfiguration {
+        let configuration = NSURLSessionConfiguration.ephemeralSessionConfiguration()
+        configuration.protocolClasses = [StandInURLProtocol.self]
+
+        return configuration
+    }
+
+    // MARK: - NSURLProtocol
+
+    override class func canInitWithRequest(request: NSURLRequest) -> Bool {
+        return true
+    }
+
+    override class func canonicalRequestForRequest(request: NSURLRequest) -> NSURLRequest {
+        return request
+    }
+
+    override func startLoading() {
+        let (responder, index) = StandInURLProtocol.withLock { () -> ((NSURLRequest, Int) -> Reply, Int) in
+            StandInURLProtocol.startedPaths.append(request.URL?.path ?? "")
+            StandInURLProtocol.runningCount += 1
+            StandInURLProtocol.maximumRunningCount = max(StandInURLProtocol.maximumRunningCount, StandInURLProtocol.runningCount)
+
+            return (StandInURLProtocol.responder, StandInURLProtocol.startedPaths.count - 1)
+        }
+
+        let reply = responder(request, index)
+
+        guard reply.delay > 0 else {
+            answerWithReply(reply)
+            return
+        }
+
+        // Client callbacks are made on the thread the loading started on
+        let thread = NSThread.currentThread()
+        let delay = dispatch_time(DISPATCH_TIME_NOW, Int64(reply.delay * Double(NSEC_PER_SEC)))
+
+        dispatch_after(delay, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0)) {
+            self.performSelector(Selector("answerWithDelayedReply:"), onThread: thread, withObject: ReplyBox(reply), waitUntilDone: false)
+        }
+    }
+
+    override func stopLoading() {}
+
+    // MARK: - Private
+
+    func answerWithDelayedReply(box: ReplyBox) {
+        answerWithReply(box.reply)
+    }
+
+    private func answerWithReply(reply: Reply) {
+        StandInURLProtocol.withLock { StandInURLProtocol.runningCount -= 1 }
+
+        if let statusCode = reply.statusCode {
+            let response = NSHTTPURLResponse(
+                URL: request.URL!,
+                statusCode: statusCode,
+                HTTPVersion: "HTTP/1.1",
+                headerFields: reply.headerFields
+            )!
+
+            client?.URLProtocol(self, didReceiveResponse: response, cacheStoragePolicy: .NotAllowed)
+
+            for chunk in reply.chunks {
+                client?.URLProtocol(self, didLoadData: chunk)
+            }
+        }
+
+        if let error = reply.error {
+            client?.URLProtocol(self, didFailWithError: error)
+        } else {
+            client?.URLProtocolDidFinishLoading(self)
+        }
+    }
+
+    private static func withLock<T>(@noescape body: () -> T) -> T {
+        lock.lock()
+        defer { lock.unlock() }
+
+        return body()
+    }
+}
+
+// MARK: -
+
+/// Carries a `Reply` through `performSelector(_:onThread:withObject:waitUntilDone:)`, which only takes objects.
+class ReplyBox: NSObject {
+    let reply: StandInURLProtocol.Reply
+
+    init(_ reply: StandInURLProtocol.Reply) {
+        self.reply = reply
+    }
+}
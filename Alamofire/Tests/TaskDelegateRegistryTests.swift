@@ -0,0 +1,121 @@
+// TaskDelegateRegistryTests.swift
+//
+// Copyright (c) 2014–2015 Alamofire Software Foundation (http://alamofire.org/)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+@testable import Alamofire
+import Foundation
+import XCTest
+
+class TaskDelegateRegistryTestCase: BaseTestCase {
+
+    // MARK: Tests
+
+    func testThatRegistryStoresAndRemovesDelegatesAcrossShards() {
+        // Given
+        let registry = TaskDelegateRegistry(shardCount: 4)
+        let session = NSURLSession.sharedSession()
+        let tasks = (0..<32).map { _ in session.dataTaskWithURL(NSURL(string: "https://httpbin.org/get")!) }
+        let delegates = tasks.map { Request.TaskDelegate(task: $0) }
+
+        // When
+        for (task, delegate) in zip(tasks, delegates) {
+            registry[task.taskIdentifier] = delegate
+        }
+
+        registry[tasks[0].taskIdentifier] = nil
+
+        // Then
+        XCTAssertEqual(registry.count, 31, "registry count should be 31")
+        XCTAssertNil(registry[tasks[0].taskIdentifier], "removed delegate should be nil")
+
+        for (task, delegate) in zip(tasks, delegates).dropFirst() {
+            XCTAssertTrue(registry[task.taskIdentifier] === delegate, "registered delegate should be returned")
+        }
+    }
+
+    func testThatRegistryIsConsistentUnderConcurrentAccess() {
+        // Given
+        let registry = TaskDelegateRegistry()
+        let task = NSURLSession.sharedSession().dataTaskWithURL(NSURL(string: "https://httpbin.org/get")!)
+        let delegate = Request.TaskDelegate(task: task)
+        let iterations = 10_000
+
+        // When
+        dispatch_apply(iterations, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0)) { index in
+            registry[index] = delegate
+            XCTAssertTrue(registry[index] === delegate, "registered delegate should be returned")
+        }
+
+        // Then
+        XCTAssertEqual(registry.count, iterations, "registry count should equal iterations")
+    }
+
+    // MARK: Benchmarks
+
+    func testPerformanceOfConcurrentRegistryLookups() {
+        let registry = TaskDelegateRegistry()
+        let task = NSURLSession.sharedSession().dataTaskWithURL(NSURL(string: "https://httpbin.org/get")!)
+        let delegate = Request.TaskDelegate(task: task)
+
+        for taskIdentifier in 0..<1_000 {
+            registry[taskIdentifier] = delegate
+        }
+
+        measureBlock {
+            dispatch_apply(1_000_000, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0)) { index in
+                _ = registry[index % 1_000]
+            }
+        }
+    }
+
+    func testPerformanceOfThousandsOfConcurrentRequestsAgainstLocalStandIn() {
+        // A small JSON body delivered in several chunks
+        let chunks = (0..<4).map { "{\"chunk\": \($0)}".dataUsingEncoding(NSUTF8StringEncoding)! }
+
+        StandInURLProtocol.reset()
+        StandInURLProtocol.responder = { _, _ in
+            StandInURLProtocol.Reply(headerFields: ["Content-Type": "application/json"], chunks: chunks)
+        }
+
+        let configuration = StandInURLProtocol.sessionConfiguration()
+        configuration.HTTPMaximumConnectionsPerHost = 64
+
+        let manager = Manager(configuration: configuration)
+        let requestCount = 2_000
+        let responseQueue = dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0)
+
+        measureBlock {
+            let group = dispatch_group_create()
+
+            for index in 0..<requestCount {
+                dispatch_group_enter(group)
+
+                manager.request(.GET, "https://stand-in.alamofire.org/\(index)")
+                    .response(queue: responseQueue) { _, _, _, _ in
+                        dispatch_group_leave(group)
+                    }
+            }
+
+            let timeout = dispatch_time(DISPATCH_TIME_NOW, Int64(self.timeout * Double(NSEC_PER_SEC)))
+            XCTAssertEqual(dispatch_group_wait(group, timeout), 0, "all requests should complete before the timeout")
+        }
+    }
+}
@@ -646,6 +646,59 @@ class UploadMultipartFormDataTestCase: BaseTestCase {
         }
     }
 
+    func testThatStreamingMultipartFormDataSetsHeadersAndUploadsEncodedStream() {
+        // Given
+        let URLString = "https://httpbin.org/post"
+        let uploadData = "upload_data".dataUsingEncoding(NSUTF8StringEncoding, allowLossyConversion: false)!
+
+        let multipartFormData = MultipartFormData()
+        multipartFormData.appendBodyPart(data: uploadData, name: "upload_data")
+
+        let expectation = expectationWithDescription("multipart form data upload should succeed")
+
+        var request: NSURLRequest?
+        var response: NSHTTPURLResponse?
+        var data: NSData?
+        var error: NSError?
+
+        // When
+        do {
+            let URLRequest = NSMutableURLRequest(URL: NSURL(string: URLString)!)
+            URLRequest.HTTPMethod = Method.POST.rawValue
+
+            try Manager.sharedInstance.upload(URLRequest, streamingMultipartFormData: multipartFormData)
+                .response { responseRequest, responseResponse, responseData, responseError in
+                    request = responseRequest
+                    response = responseResponse
+                    data = responseData
+                    error = responseError
+
+                    expectation.fulfill()
+                }
+        } catch {
+            expectation.fulfill()
+        }
+
+        waitForExpectationsWithTimeout(timeout, handler: nil)
+
+        // Then
+        XCTAssertNotNil(request, "request should not be nil")
+        XCTAssertNotNil(response, "response should not be nil")
+        XCTAssertNotNil(data, "data should not be nil")
+        XCTAssertNil(error, "error should be nil")
+
+        XCTAssertEqual(
+            request?.valueForHTTPHeaderField("Content-Type") ?? "",
+            multipartFormData.contentType,
+            "Content-Type header value should match"
+        )
+        XCTAssertEqual(
+            request?.valueForHTTPHeaderField("Content-Length") ?? "",
+            "\(multipartFormData.encodedContentLength)",
+            "Content-Length header value should match"
+        )
+    }
+
     // MARK: Combined Test Execution
 
     private func executeMultipartFormDataUploadRequestWithProgress(streamFromDisk streamFromDisk: Bool) {
@@ -528,3 +528,122 @@ class AutomaticValidationTestCase: BaseTestCase {
         }
     }
 }
+
+// MARK: -
+
+class CompiledValidatorTestCase: BaseTestCase {
+    func HTTPResponse(statusCode statusCode: Int, contentType: String?) -> NSHTTPURLResponse {
+        let headers = contentType.map { ["Content-Type": $0] }
+        return NSHTTPURLResponse(URL: NSURL(string: "https://example.com")!, statusCode: statusCode, HTTPVersion: "HTTP/1.1", headerFields: headers)!
+    }
+
+    func isSuccess(result: Request.ValidationResult) -> Bool {
+        if case .Success = result { return true }
+        return false
+    }
+
+    func errorCode(result: Request.ValidationResult) -> Int? {
+        if case let .Failure(error) = result { return error.code }
+        return nil
+    }
+
+    func testThatValidatorAcceptsOnlyTheCompiledStatusCodes() {
+        // Given
+        let validator = CompiledValidator(statusCode: [200, 204, 304, 1_000_000, -1])
+
+        // When
+        let accepted = [200, 204, 304].filter { isSuccess(validator.validate(HTTPResponse(statusCode: $0, contentType: nil), dataLength: 0)) }
+        let rejectedResult = validator.validate(HTTPResponse(statusCode: 201, contentType: nil), dataLength: 0)
+
+        // Then
+        XCTAssertEqual(accepted, [200, 204, 304], "compiled status codes should be accepted")
+        XCTAssertEqual(errorCode(rejectedResult), Error.Code.StatusCodeValidationFailed.rawValue, "error should be status code validation failure")
+    }
+
+    func testThatValidatorClampsStatusCodeRanges() {
+        // Given
+        let validator = CompiledValidator(statusCode: -100..<Int(Int32.max))
+
+        // When
+        let lowResult = validator.validate(HTTPResponse(statusCode: 100, contentType: nil), dataLength: 0)
+        let highResult = validator.validate(HTTPResponse(statusCode: 599, contentType: nil), dataLength: 0)
+
+        // Then
+        XCTAssertTrue(isSuccess(lowResult), "status code 100 should be accepted")
+        XCTAssertTrue(isSuccess(highResult), "status code 599 should be accepted")
+    }
+
+    func testThatValidatorMatchesExactAndWildcardContentTypes() {
+        // Given
+        let validator = CompiledValidator(contentType: ["application/json", "text/*", "*/xml; charset=utf-8"])
+
+        // When
+        let contentTypes = ["application/json", "Application/JSON; charset=utf-8", "text/plain", "image/xml", "image/png"]
+        let accepted = contentTypes.filter { isSuccess(validator.validate(HTTPResponse(statusCode: 200, contentType: $0), dataLength: 1)) }
+
+        // Then
+        XCTAssertEqual(accepted, ["application/json", "Application/JSON; charset=utf-8", "text/plain", "image/xml"], "exact and wildcard content types should be accepted")
+    }
+
+    func testThatValidatorRejectsUnacceptableOrMissingContentType() {
+        // Given
+        let validator = CompiledValidator(contentType: ["application/json"])
+
+        // When
+        let unacceptableResult = validator.validate(HTTPResponse(statusCode: 200, contentType: "image/png"), dataLength: 1)
+        let missingResult = validator.validate(HTTPResponse(statusCode: 200, contentType: nil), dataLength: 1)
+        let emptyResult = validator.validate(HTTPResponse(statusCode: 200, contentType: "image/png"), dataLength: 0)
+
+        // Then
+        XCTAssertEqual(errorCode(unacceptableResult), Error.Code.ContentTypeValidationFailed.rawValue, "error should be content type validation failure")
+        XCTAssertEqual(errorCode(missingResult), Error.Code.ContentTypeValidationFailed.rawValue, "error should be content type validation failure")
+        XCTAssertTrue(isSuccess(emptyResult), "content type should not be validated for empty data")
+    }
+
+    func testThatAnyContentTypeWildcardAcceptsMissingContentType() {
+        // Given
+        let validator = CompiledValidator(contentType: ["application/json", "*/*"])
+
+        // When
+        let result = validator.validate(HTTPResponse(statusCode: 200, contentType: nil), dataLength: 1)
+
+        // Then
+        XCTAssertTrue(isSuccess(result), "*/* should accept a missing content type")
+    }
+
+    func testThatAutomaticValidatorIsSharedForTheSameAcceptHeader() {
+        // Given
+        let accept = "application/json, text/*;q=0.8"
+
+        // When
+        let first = CompiledValidator.automaticValidatorForAccept(accept)
+        let second = CompiledValidator.automaticValidatorForAccept(accept)
+        let other = CompiledValidator.automaticValidatorForAccept("image/png")
+
+        // Then
+        XCTAssertTrue(first === second, "validators for the same Accept header should be shared")
+        XCTAssertFalse(first === other, "validators for different Accept headers should differ")
+    }
+
+    func testThatRequestValidationWithCompiledValidatorFails() {
+        // Given
+        let validator = CompiledValidator(statusCode: [200], contentType: ["application/json"])
+        let expectation = expectationWithDescription("request should return 404 status code")
+
+        var error: NSError?
+
+        // When
+        Alamofire.request(.GET, "https://httpbin.org/status/404")
+            .validate(validator)
+            .response { _, _, _, responseError in
+                error = responseError
+                expectation.fulfill()
+            }
+
+        waitForExpectationsWithTimeout(timeout, handler: nil)
+
+        // Then
+        XCTAssertNotNil(error, "error should not be nil")
+        XCTAssertEqual(error?.code ?? 0, Error.Code.StatusCodeValidationFailed.rawValue, "code should be status code validation failure")
+    }
+}
@@ -0,0 +1,832 @@
+//
+//  JSONTape.swift
+//  IPMQuickstart
+//
+//  Copyright © 2015 Twilio. All rights reserved.
+//
+
+import Foundation
+
+// MARK: - JSONTape
+
+/**
+  A compact, tagged store for a parsed JSON document.
+
+  Every value is a node, laid out in document (pre-)order in a handful of flat arrays rather
+  than as a tree of `NSArray`/`NSDictionary`/`NSNumber` objects. Containers record the index
+  one past their subtree, so a lookup can skip over siblings without visiting their children.
+  Arrays also record the node of each element, so indexing one takes constant time. Object
+  members are stored as alternating key and value nodes.
+
+  A lazy tape (see `index(_:)`) keeps the source bytes alive and stores strings and numbers as
+  byte ranges into them. Those are only decoded when the node is read, and object keys are
+  matched by comparing bytes, so untouched members never allocate. Strings are still fully
+  validated while indexing, so decoding one later cannot fail.
+*/
+final class JSONTape {
+  enum Tag: UInt8 {
+    case Null, True, False, Integer, Double, String, Array, Object
+    // Undecoded scalars of a lazy tape
+    case RawInteger, RawDouble, RawString, RawEscapedString
+  }
+
+  /// Maximum container nesting accepted by the tokenizer before it gives up
+  static let maximumDepth = 512
+
+  private(set) var tags: [Tag] = []
+  // Integer/Double/String: index into the matching scalar pool; Array: start of its run in
+  // `elementNodes`; Object: member count; raw scalars: byte offset of the value (of its
+  // contents, for strings)
+  private var payloads: [Int] = []
+  // Array/Object: index of the first node after the container's subtree; raw scalars: byte length
+  private var extents: [Int] = []
+  // One run per array: its element count, then the node of each element
+  private var elementNodes: [Int] = []
+
+  private var integers: [Int64] = []
+  private var doubles: [Double] = []
+  private var strings: [String] = []
+
+  // Source of a lazy tape, retained so raw scalars can be decoded on demand
+  private let data: NSData?
+  private let bytes: UnsafeBufferPointer<UInt8>
+
+  private init(data: NSData? = nil) {
+    self.data = data
+    if let data = data {
+      self.bytes = UnsafeBufferPointer(start: UnsafePointer<UInt8>(data.bytes), count: data.length)
+    } else {
+      self.bytes = UnsafeBufferPointer(start: nil, count: 0)
+    }
+  }
+
+  /**
+    Tokenizes UTF-8 encoded JSON in a single pass.
+
+    - parameter bytes: The UTF-8 encoded document. Any JSON value is accepted at the top level.
+
+    - throws: An `NSError` in `ErrorDomain` with code `ErrorInvalidJSON` describing the first
+      malformed byte.
+
+    - returns: The tape for the document, with the root value at node `0`.
+  */
+  static func parse(bytes: UnsafeBufferPointer<UInt8>) throws -> JSONTape {
+    var tokenizer = JSONTokenizer(bytes: bytes, tape: JSONTape(), lazy: false)
+    try tokenizer.parseDocument()
+    return tokenizer.tape
+  }
+
+  /**
+    Validates UTF-8 encoded JSON and indexes its structure without decoding any strings or numbers.
+
+    - parameter data: The UTF-8 encoded document. Immutable data is retained rather than copied.
+
+    - throws: An `NSError` in `ErrorDomain` with code `ErrorInvalidJSON` describing the first
+      malformed byte.
+
+    - returns: A lazy tape for the document, with the root value at node `0`.
+  */
+  static func index(data: NSData) throws -> JSONTape {
+    let tape = JSONTape(data: data.copy() as! NSData)
+    var tokenizer = JSONTokenizer(bytes: tape.bytes, tape: tape, lazy: true)
+    try tokenizer.parseDocument()
+    return tape
+  }
+
+  // MARK: Building
+
+  private func append(tag: Tag, payload: Int = 0) {
+    tags.append(tag)
+    payloads.append(payload)
+    extents.append(0)
+  }
+
+  private func appendRaw(tag: Tag, offset: Int, length: Int) {
+    tags.append(tag)
+    payloads.append(offset)
+    extents.append(length)
+  }
+
+  private func appendInteger(value: Int64) {
+    append(.Integer, payload: integers.count)
+    integers.append(value)
+  }
+
+  private func appendDouble(value: Double) {
+    append(.Double, payload: doubles.count)
+    doubles.append(value)
+  }
+
+  private func appendString(value: String) {
+    append(.String, payload: strings.count)
+    strings.append(value)
+  }
+
+  private func beginContainer(tag: Tag) -> Int {
+    append(tag)
+    return tags.count - 1
+  }
+
+  private func endContainer(node: Int, count: Int) {
+    payloads[node] = count
+    extents[node] = tags.count
+  }
+
+  private func endArray(node: Int, elements: ArraySlice<Int>) {
+    payloads[node] = elementNodes.count
+    extents[node] = tags.count
+    elementNodes.append(elements.count)
+    elementNodes.appendContentsOf(elements)
+  }
+
+  // MARK: Reading
+
+  /// Index of the first node after the subtree rooted at `node`
+  func next(node: Int) -> Int {
+    switch tags[node] {
+    case .Array, .Object:
+      return extents[node]
+    default:
+      return node + 1
+    }
+  }
+
+  /// Number of elements (arrays) or members (objects) in the container at `node`
+  func count(node: Int) -> Int {
+    return tags[node] == .Array ? elementNodes[payloads[node]] : payloads[node]
+  }
+
+  /// Node of the element at `index` in the array at `node`, or `nil` when out of bounds
+  func element(node: Int, index: Int) -> Int? {
+    guard index >= 0 && index < elementNodes[payloads[node]] else {
+      return nil
+    }
+    return elementNodes[payloads[node] + 1 + index]
+  }
+
+  /// Nodes of every element in the array at `node`
+  func elements(node: Int) -> [Int] {
+    let start = payloads[node] + 1
+    return Array(elementNodes[start..<start + elementNodes[payloads[node]]])
+  }
+
+  /**
+    Value node for `key` in the object at `node`, or `nil` when the key does not exist.
+
+    Keys match when their UTF-8 bytes are identical, without Unicode normalization, the way
+    `NSDictionary` compares `NSString` keys. A key written with a precomposed "é" does not
+    match one written as "e" and a combining accent, although Swift considers them equal.
+
+    When the key appears more than once, the last occurrence wins, as it does in
+    `dictionaryObject(_:)` and `NSJSONSerialization`.
+  */
+  func value(node: Int, forKey key: String) -> Int? {
+    var value: Int?
+    var child = node + 1
+    for _ in 0..<payloads[node] {
+      if keyNode(child, matches: key) {
+        value = child + 1
+      }
+      child = next(child + 1)
+    }
+    return value
+  }
+
+  private func keyNode(node: Int, matches key: String) -> Bool {
+    guard tags[node] == .RawString else {
+      return string(node).utf8.elementsEqual(key.utf8)
+    }
+
+    var offset = payloads[node]
+    let end = offset + extents[node]
+    for unit in key.utf8 {
+      if offset == end || bytes[offset] != unit {
+        return false
+      }
+      offset += 1
+    }
+    return offset == end
+  }
+
+  /// Key and value nodes of every member in the object at `node`
+  func members(node: Int) -> [(key: String, value: Int)] {
+    var members: [(key: String, value: Int)] = []
+    members.reserveCapacity(payloads[node])
+
+    var child = node + 1
+    for _ in 0..<payloads[node] {
+      members.append((string(child), child + 1))
+      child = next(child + 1)
+    }
+    return members
+  }
+
+  /// Decoded string at `node`
+  func string(node: Int) -> String {
+    switch tags[node] {
+    case .RawString:
+      // The tokenizer checked the bytes are valid UTF-8 when the tape was indexed
+      let start = bytes.baseAddress + payloads[node]
+      return NSString(bytes: start, length: extents[node], encoding: NSUTF8StringEncoding)! as String
+    case .RawEscapedString:
+      // Re-run the tokenizer from the opening quote so escapes are handled in one place. It
+      // already accepted the string once, while indexing.
+      var tokenizer = JSONTokenizer(bytes: bytes, tape: self, lazy: false)
+      tokenizer.position = payloads[node] - 1
+      return try! tokenizer.parseString()
+    default:
+      return strings[payloads[node]]
+    }
+  }
+
+  func number(node: Int) -> NSNumber {
+    switch tags[node] {
+    case .Integer:
+      return NSNumber(longLong: integers[payloads[node]])
+    case .Double:
+      return NSNumber(double: doubles[payloads[node]])
+    case .RawInteger, .RawDouble:
+      var scratch: [UInt8] = []
+      let start = payloads[node]
+      switch decodeNumber(bytes, start: start, end: start + extents[node], isInteger: tags[node] == .RawInteger, scratch: &scratch) {
+      case .Integer(let value):
+        return NSNumber(longLong: value)
+      case .Double(let value):
+        return NSNumber(double: value)
+      }
+    case .True:
+      return NSNumber(bool: true)
+    default:
+      return NSNumber(bool: false)
+    }
+  }
+
+  /// Builds the Foundation object tree for the subtree at `node`, as `NSJSONSerialization` would
+  func object(node: Int) -> AnyObject {
+    switch tags[node] {
+    case .Null:
+      return NSNull()
+    case .True, .False, .Integer, .Double, .RawInteger, .RawDouble:
+      return number(node)
+    case .String, .RawString, .RawEscapedString:
+      return string(node)
+    case .Array:
+      return arrayObject(node)
+    case .Object:
+      return dictionaryObject(node)
+    }
+  }
+
+  func arrayObject(node: Int) -> [AnyObject] {
+    return elements(node).map { object($0) }
+  }
+
+  func dictionaryObject(node: Int) -> [String: AnyObject] {
+    var dictionary = [String: AnyObject](minimumCapacity: payloads[node])
+    for member in members(node) {
+      dictionary[member.key] = object(member.value)
+    }
+    return dictionary
+  }
+}
+
+// MARK: - Tokenizer
+
+private struct ASCII {
+  static let tab: UInt8 = 0x09
+  static let newline: UInt8 = 0x0A
+  static let carriageReturn: UInt8 = 0x0D
+  static let space: UInt8 = 0x20
+  static let quote: UInt8 = 0x22
+  static let plus: UInt8 = 0x2B
+  static let comma: UInt8 = 0x2C
+  static let minus: UInt8 = 0x2D
+  static let period: UInt8 = 0x2E
+  static let slash: UInt8 = 0x2F
+  static let zero: UInt8 = 0x30
+  static let nine: UInt8 = 0x39
+  static let colon: UInt8 = 0x3A
+  static let upperA: UInt8 = 0x41
+  static let upperE: UInt8 = 0x45
+  static let upperF: UInt8 = 0x46
+  static let openBracket: UInt8 = 0x5B
+  static let backslash: UInt8 = 0x5C
+  static let closeBracket: UInt8 = 0x5D
+  static let lowerA: UInt8 = 0x61
+  static let lowerB: UInt8 = 0x62
+  static let lowerE: UInt8 = 0x65
+  static let lowerF: UInt8 = 0x66
+  static let lowerN: UInt8 = 0x6E
+  static let lowerR: UInt8 = 0x72
+  static let lowerT: UInt8 = 0x74
+  static let lowerU: UInt8 = 0x75
+  static let openBrace: UInt8 = 0x7B
+  static let closeBrace: UInt8 = 0x7D
+}
+
+private let trueLiteral: [UInt8] = [0x74, 0x72, 0x75, 0x65]
+private let falseLiteral: [UInt8] = [0x66, 0x61, 0x6C, 0x73, 0x65]
+private let nullLiteral: [UInt8] = [0x6E, 0x75, 0x6C, 0x6C]
+
+/// Recursive-descent tokenizer that writes straight into a `JSONTape`
+private struct JSONTokenizer {
+  let bytes: UnsafeBufferPointer<UInt8>
+  let tape: JSONTape
+  // Record strings and numbers as byte ranges instead of decoding them
+  let lazy: Bool
+  var position = 0
+  var depth = 0
+  // Element nodes of the arrays being parsed, innermost array last
+  var elementStack: [Int] = []
+  // Reused for strings with escapes and for numbers handed to `strtoll` or `strtod`
+  var scratch: [UInt8] = []
+
+  init(bytes: UnsafeBufferPointer<UInt8>, tape: JSONTape, lazy: Bool) {
+    self.bytes = bytes
+    self.tape = tape
+    self.lazy = lazy
+  }
+
+  mutating func parseDocument() throws {
+    skipWhitespace()
+    try parseValue()
+    skipWhitespace()
+
+    if position != bytes.count {
+      throw error("Unexpected data after the top-level value")
+    }
+  }
+
+  // MARK: Values
+
+  mutating func parseValue() throws {
+    guard position < bytes.count else {
+      throw error("Unexpected end of data")
+    }
+
+    switch bytes[position] {
+    case ASCII.openBrace:
+      try parseObject()
+    case ASCII.openBracket:
+      try parseArray()
+    case ASCII.quote:
+      try parseStringValue()
+    case ASCII.lowerT:
+      try consumeLiteral(trueLiteral)
+      tape.append(.True)
+    case ASCII.lowerF:
+      try consumeLiteral(falseLiteral)
+      tape.append(.False)
+    case ASCII.lowerN:
+      try consumeLiteral(nullLiteral)
+      tape.append(.Null)
+    default:
+      try parseNumber()
+    }
+  }
+
+  mutating func parseArray() throws {
+    let node = try beginContainer(.Array)
+    let base = elementStack.count
+
+    skipWhitespace()
+    if position < bytes.count && bytes[position] == ASCII.closeBracket {
+      position += 1
+    } else {
+      while true {
+        skipWhitespace()
+        elementStack.append(tape.tags.count)
+        try parseValue()
+
+        skipWhitespace()
+        let separator = try consumeByte()
+        if separator == ASCII.comma {
+          continue
+        } else if separator == ASCII.closeBracket {
+          break
+        }
+        throw error("Expected ',' or ']' in array", at: position - 1)
+      }
+    }
+
+    endArray(node, elements: base)
+  }
+
+  mutating func parseObject() throws {
+    let node = try beginContainer(.Object)
+    var count = 0
+
+    skipWhitespace()
+    if position < bytes.count && bytes[position] == ASCII.closeBrace {
+      position += 1
+    } else {
+      while true {
+        skipWhitespace()
+        guard position < bytes.count && bytes[position] == ASCII.quote else {
+          throw error("Expected a string key in object")
+        }
+        try parseStringValue()
+
+        skipWhitespace()
+        guard try consumeByte() == ASCII.colon else {
+          throw error("Expected ':' after object key", at: position - 1)
+        }
+
+        skipWhitespace()
+        try parseValue()
+        count += 1
+
+        skipWhitespace()
+        let separator = try consumeByte()
+        if separator == ASCII.comma {
+          continue
+        } else if separator == ASCII.closeBrace {
+          break
+        }
+        throw error("Expected ',' or '}' in object", at: position - 1)
+      }
+    }
+
+    endContainer(node, count: count)
+  }
+
+  mutating func beginContainer(tag: JSONTape.Tag) throws -> Int {
+    depth += 1
+    guard depth <= JSONTape.maximumDepth else {
+      throw error("Containers are nested too deeply")
+    }
+    position += 1
+    return tape.beginContainer(tag)
+  }
+
+  mutating func endContainer(node: Int, count: Int) {
+    depth -= 1
+    tape.endContainer(node, count: count)
+  }
+
+  mutating func endArray(node: Int, elements base: Int) {
+    depth -= 1
+    tape.endArray(node, elements: elementStack[base..<elementStack.count])
+    elementStack.removeRange(base..<elementStack.count)
+  }
+
+  // MARK: Strings
+
+  mutating func parseStringValue() throws {
+    if lazy {
+      let start = position + 1
+      let escaped = try skipString()
+      tape.appendRaw(escaped ? .RawEscapedString : .RawString, offset: start, length: position - 1 - start)
+    } else {
+      tape.appendString(try parseString())
+    }
+  }
+
+  /**
+    Moves past the string at `position` and returns whether it contains escapes.
+
+    The string is validated as thoroughly as `parseString()` would, UTF-8 and escapes included,
+    so that decoding it later from a lazy tape cannot fail.
+  */
+  mutating func skipString() throws -> Bool {
+    let start = position
+    var escaped = false
+    position += 1
+
+    while position < bytes.count {
+      let byte = bytes[position]
+      position += 1
+
+      if byte == ASCII.quote {
+        return escaped
+      } else if byte == ASCII.backslash {
+        escaped = true
+        try parseEscape()
+      } else if byte < ASCII.space {
+        throw error("Unescaped control character in string", at: position - 1)
+      } else if byte >= 0x80 {
+        try skipUTF8Continuation(byte)
+      }
+    }
+
+    throw error("Unterminated string", at: start)
+  }
+
+  /// Moves past the continuation bytes of the UTF-8 sequence starting with `lead`, which was
+  /// just consumed, rejecting overlong forms, surrogates and scalars above U+10FFFF
+  mutating func skipUTF8Continuation(lead: UInt8) throws {
+    let count: Int
+    var lower: UInt8 = 0x80
+    var upper: UInt8 = 0xBF
+
+    switch lead {
+    case 0xC2...0xDF:
+      count = 1
+    case 0xE0:
+      count = 2
+      lower = 0xA0
+    case 0xED:
+      count = 2
+      upper = 0x9F
+    case 0xE1...0xEF:
+      count = 2
+    case 0xF0:
+      count = 3
+      lower = 0x90
+    case 0xF4:
+      count = 3
+      upper = 0x8F
+    case 0xF1...0xF3:
+      count = 3
+    default:
+      throw error("Invalid UTF-8 in string", at: position - 1)
+    }
+
+    for index in 0..<count {
+      guard position < bytes.count else {
+        throw error("Unterminated string")
+      }
+      let byte = bytes[position]
+      // Only the first continuation byte has a narrower range
+      guard index == 0 ? byte >= lower && byte <= upper : byte >= 0x80 && byte <= 0xBF else {
+        throw error("Invalid UTF-8 in string")
+      }
+      position += 1
+    }
+  }
+
+  mutating func parseString() throws -> String {
+    position += 1
+    let start = position
+
+    // Fast path: no escapes, so the string can be decoded directly from the input bytes
+    while position < bytes.count {
+      let byte = bytes[position]
+      if byte == ASCII.quote {
+        let string = try makeString(bytes.baseAddress + start, count: position - start)
+        position += 1
+        return string
+      } else if byte == ASCII.backslash {
+        scratch.removeAll(keepCapacity: true)
+        scratch.appendContentsOf(UnsafeBufferPointer(start: bytes.baseAddress + start, count: position - start))
+        return try parseEscapedString()
+      } else if byte < ASCII.space {
+        throw error("Unescaped control character in string")
+      }
+      position += 1
+    }
+
+    throw error("Unterminated string", at: start - 1)
+  }
+
+  mutating func parseEscapedString() throws -> String {
+    while position < bytes.count {
+      let byte = bytes[position]
+      position += 1
+
+      if byte == ASCII.quote {
+        guard let string = String(bytes: scratch, encoding: NSUTF8StringEncoding) else {
+          throw error("Invalid UTF-8 in string")
+        }
+        return string
+      } else if byte < ASCII.space {
+        throw error("Unescaped control character in string", at: position - 1)
+      } else if byte != ASCII.backslash {
+        scratch.append(byte)
+        continue
+      }
+
+      appendUTF8(try parseEscape())
+    }
+
+    throw error("Unterminated string")
+  }
+
+  /// Decodes the escape sequence following a backslash, returning the Unicode scalar it stands for
+  mutating func parseEscape() throws -> UInt32 {
+    switch try consumeByte() {
+    case ASCII.quote:
+      return UInt32(ASCII.quote)
+    case ASCII.backslash:
+      return UInt32(ASCII.backslash)
+    case ASCII.slash:
+      return UInt32(ASCII.slash)
+    case ASCII.lowerB:
+      return 0x08
+    case ASCII.lowerF:
+      return 0x0C
+    case ASCII.lowerN:
+      return UInt32(ASCII.newline)
+    case ASCII.lowerR:
+      return UInt32(ASCII.carriageReturn)
+    case ASCII.lowerT:
+      return UInt32(ASCII.tab)
+    case ASCII.lowerU:
+      let scalar = try parseHexQuad()
+      if scalar >= 0xD800 && scalar <= 0xDBFF {
+        guard try consumeByte() == ASCII.backslash else {
+          throw error("Unpaired UTF-16 surrogate in string", at: position - 1)
+        }
+        guard try consumeByte() == ASCII.lowerU else {
+          throw error("Unpaired UTF-16 surrogate in string", at: position - 1)
+        }
+        let low = try parseHexQuad()
+        guard low >= 0xDC00 && low <= 0xDFFF else {
+          throw error("Unpaired UTF-16 surrogate in string", at: position - 1)
+        }
+        return 0x10000 + ((scalar - 0xD800) << 10) + (low - 0xDC00)
+      } else if scalar >= 0xDC00 && scalar <= 0xDFFF {
+        throw error("Unpaired UTF-16 surrogate in string", at: position - 1)
+      }
+      return scalar
+    default:
+      throw error("Invalid escape sequence in string", at: position - 1)
+    }
+  }
+
+  mutating func parseHexQuad() throws -> UInt32 {
+    var value: UInt32 = 0
+    for _ in 0..<4 {
+      let byte = try consumeByte()
+      let digit: UInt8
+      switch byte {
+      case ASCII.zero...ASCII.nine:
+        digit = byte - ASCII.zero
+      case ASCII.lowerA...ASCII.lowerF:
+        digit = byte - ASCII.lowerA + 10
+      case ASCII.upperA...ASCII.upperF:
+        digit = byte - ASCII.upperA + 10
+      default:
+        throw error("Invalid \\u escape in string", at: position - 1)
+      }
+      value = value << 4 | UInt32(digit)
+    }
+    return value
+  }
+
+  mutating func appendUTF8(scalar: UInt32) {
+    switch scalar {
+    case 0..<0x80:
+      scratch.append(UInt8(scalar))
+    case 0x80..<0x800:
+      scratch.append(UInt8(0xC0 | scalar >> 6))
+      scratch.append(UInt8(0x80 | scalar & 0x3F))
+    case 0x800..<0x10000:
+      scratch.append(UInt8(0xE0 | scalar >> 12))
+      scratch.append(UInt8(0x80 | scalar >> 6 & 0x3F))
+      scratch.append(UInt8(0x80 | scalar & 0x3F))
+    default:
+      scratch.append(UInt8(0xF0 | scalar >> 18))
+      scratch.append(UInt8(0x80 | scalar >> 12 & 0x3F))
+      scratch.append(UInt8(0x80 | scalar >> 6 & 0x3F))
+      scratch.append(UInt8(0x80 | scalar & 0x3F))
+    }
+  }
+
+  func makeString(start: UnsafePointer<UInt8>, count: Int) throws -> String {
+    if count == 0 {
+      return ""
+    }
+    guard let string = NSString(bytes: start, length: count, encoding: NSUTF8StringEncoding) else {
+      throw error("Invalid UTF-8 in string", at: position)
+    }
+    return string as String
+  }
+
+  // MARK: Numbers
+
+  mutating func parseNumber() throws {
+    let start = position
+    var isInteger = true
+
+    if bytes[position] == ASCII.minus {
+      position += 1
+    }
+
+    guard position < bytes.count && isDigit(bytes[position]) else {
+      throw error("Invalid value", at: start)
+    }
+    if bytes[position] == ASCII.zero {
+      position += 1
+    } else {
+      skipDigits()
+    }
+
+    if position < bytes.count && bytes[position] == ASCII.period {
+      isInteger = false
+      position += 1
+      guard position < bytes.count && isDigit(bytes[position]) else {
+        throw error("Expected digits after decimal point")
+      }
+      skipDigits()
+    }
+
+    if position < bytes.count && (bytes[position] == ASCII.lowerE || bytes[position] == ASCII.upperE) {
+      isInteger = false
+      position += 1
+      if position < bytes.count && (bytes[position] == ASCII.plus || bytes[position] == ASCII.minus) {
+        position += 1
+      }
+      guard position < bytes.count && isDigit(bytes[position]) else {
+        throw error("Expected digits in exponent")
+      }
+      skipDigits()
+    }
+
+    if lazy {
+      tape.appendRaw(isInteger ? .RawInteger : .RawDouble, offset: start, length: position - start)
+      return
+    }
+
+    switch decodeNumber(bytes, start: start, end: position, isInteger: isInteger, scratch: &scratch) {
+    case .Integer(let value):
+      tape.appendInteger(value)
+    case .Double(let value):
+      tape.appendDouble(value)
+    }
+  }
+
+  mutating func skipDigits() {
+    while position < bytes.count && isDigit(bytes[position]) {
+      position += 1
+    }
+  }
+
+  func isDigit(byte: UInt8) -> Bool {
+    return byte >= ASCII.zero && byte <= ASCII.nine
+  }
+
+  // MARK: Helpers
+
+  mutating func skipWhitespace() {
+    while position < bytes.count {
+      switch bytes[position] {
+      case ASCII.space, ASCII.newline, ASCII.carriageReturn, ASCII.tab:
+        position += 1
+      default:
+        return
+      }
+    }
+  }
+
+  mutating func consumeByte() throws -> UInt8 {
+    guard position < bytes.count else {
+      throw error("Unexpected end of data")
+    }
+    position += 1
+    return bytes[position - 1]
+  }
+
+  mutating func consumeLiteral(literal: [UInt8]) throws {
+    guard bytes.count - position >= literal.count else {
+      throw error("Invalid value")
+    }
+    for (offset, byte) in literal.enumerate() where bytes[position + offset] != byte {
+      throw error("Invalid value")
+    }
+    position += literal.count
+  }
+
+  func error(reason: String, at offset: Int? = nil) -> NSError {
+    let offset = offset ?? position
+    return NSError(domain: ErrorDomain, code: ErrorInvalidJSON, userInfo: [
+      NSLocalizedDescriptionKey: "Invalid JSON at byte \(offset): \(reason)"
+    ])
+  }
+}
+
+// MARK: - Numbers
+
+private enum JSONNumber {
+  case Integer(Int64)
+  case Double(Swift.Double)
+}
+
+/// Decodes the already validated number in `bytes[start..<end]`, using `scratch` for `strtoll`
+/// and `strtod`. Integers that overflow an `Int64` decode as `Double`.
+private func decodeNumber(bytes: UnsafeBufferPointer<UInt8>, start: Int, end: Int, isInteger: Bool, inout scratch: [UInt8]) -> JSONNumber {
+  // Up to 18 digits always fit in an Int64, so short integers never need `strtoll`
+  if isInteger && end - start <= 18 {
+    let negative = bytes[start] == ASCII.minus
+    var value: Int64 = 0
+    for index in (negative ? start + 1 : start)..<end {
+      value = value * 10 + Int64(bytes[index] - ASCII.zero)
+    }
+    return .Integer(negative ? -value : value)
+  }
+
+  scratch.removeAll(keepCapacity: true)
+  scratch.appendContentsOf(UnsafeBufferPointer(start: bytes.baseAddress + start, count: end - start))
+  scratch.append(0)
+
+  // Longer integers may still fit, as NSJSONSerialization keeps them when they do
+  if isInteger {
+    errno = 0
+    let value = scratch.withUnsafeBufferPointer { strtoll(UnsafePointer($0.baseAddress), nil, 10) }
+    if errno != ERANGE {
+      return .Integer(value)
+    }
+  }
+
+  return .Double(scratch.withUnsafeBufferPointer { strtod(UnsafePointer($0.baseAddress), nil) })
+}
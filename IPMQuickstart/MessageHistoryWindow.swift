@@ -0,0 +1,140 @@
+//
+//  MessageHistoryWindow.swift
+//  IPMQuickstart
+//
+//  Copyright © 2015 Twilio. All rights reserved.
+//
+
+import Foundation
+
+/**
+  A sliding window over a channel's message history.
+
+  Only the messages inside the window are copied into the timeline the table shows. Opening a
+  channel materializes just the newest page, whatever the length of the history; older and
+  newer pages are brought in as the user scrolls, and whenever the window grows past
+  `maximumResidentMessages` the pages at the far end are released again.
+
+  `reset(_:)` sorts the history by timestamp, since the window's pages are ranges of it. Live
+  messages are appended as they arrive.
+*/
+final class MessageHistoryWindow {
+  let timeline: MessageTimeline
+  let pageSize: Int
+  let maximumResidentMessages: Int
+
+  private var history: [MessageRecord] = []
+  // Indexes into `history` of the messages materialized in `timeline`
+  private var window = 0..<0
+  // Indexes into `history` of materialized messages with an empty `sid`. They cannot be told apart
+  // in the timeline, so they stay resident until the next reset rather than being re-inserted.
+  private var unidentifiedResidents = Set<Int>()
+
+  init(timeline: MessageTimeline, pageSize: Int = 50, maximumResidentMessages: Int = 500) {
+    self.timeline = timeline
+    self.pageSize = pageSize
+    self.maximumResidentMessages = max(maximumResidentMessages, pageSize * 2)
+  }
+
+  var hasOlderMessages: Bool {
+    return window.startIndex > 0
+  }
+
+  var hasNewerMessages: Bool {
+    return window.endIndex < history.count
+  }
+
+  /// Whether live messages are shown as they arrive, because the newest page is in the window
+  var isAtLiveEdge: Bool {
+    return !hasNewerMessages
+  }
+
+  /// Replaces the history and materializes only its newest page. The table needs a reload.
+  func reset(history: [MessageRecord]) {
+    // Sorted by timestamp, keeping the channel's order for equal timestamps
+    self.history = history.enumerate().sort { a, b in
+      a.element.timestamp != b.element.timestamp ? a.element.timestamp < b.element.timestamp : a.index < b.index
+    }.map { $0.element }
+    timeline.removeAll()
+    unidentifiedResidents.removeAll()
+
+    window = max(history.count - pageSize, 0)..<history.count
+    timeline.insert(records(window))
+  }
+
+  /// Brings the page before the window in, releasing pages at the newest end if needed
+  func loadOlderPage() -> MessageTimelineUpdate {
+    let page = max(window.startIndex - pageSize, 0)..<window.startIndex
+    window.startIndex = page.startIndex
+
+    var released = 0..<0
+    let overflow = window.count - maximumResidentMessages
+    if overflow > 0 {
+      released = window.endIndex - overflow..<window.endIndex
+      window.endIndex = released.startIndex
+    }
+
+    return apply(page, releasing: released)
+  }
+
+  /// Brings the page after the window in, releasing pages at the oldest end if needed
+  func loadNewerPage() -> MessageTimelineUpdate {
+    let page = window.endIndex..<min(window.endIndex + pageSize, history.count)
+    window.endIndex = page.endIndex
+
+    var released = 0..<0
+    let overflow = window.count - maximumResidentMessages
+    if overflow > 0 {
+      released = window.startIndex..<window.startIndex + overflow
+      window.startIndex = released.endIndex
+    }
+
+    return apply(page, releasing: released)
+  }
+
+  /**
+    Adds messages received live to the end of the history.
+
+    - returns: The rows to insert, which is empty unless the window is at the live edge. When it
+      is, the window follows the new messages and releases the oldest pages past the limit.
+  */
+  func appendLive(messages: [MessageRecord]) -> MessageTimelineUpdate {
+    let wasAtLiveEdge = isAtLiveEdge
+    let added = history.count..<history.count + messages.count
+    history.appendContentsOf(messages)
+
+    guard wasAtLiveEdge else {
+      return MessageTimelineUpdate(previousCount: timeline.count, insertedRows: [])
+    }
+
+    window.endIndex = added.endIndex
+    var released = 0..<0
+    let overflow = window.count - maximumResidentMessages
+    if overflow > 0 {
+      released = window.startIndex..<window.startIndex + overflow
+      window.startIndex = released.endIndex
+    }
+
+    return apply(added, releasing: released)
+  }
+
+  // MARK: Helpers
+
+  private func apply(page: Range<Int>, releasing released: Range<Int>) -> MessageTimelineUpdate {
+    let previousCount = timeline.count
+    let removedSids = Set(released.map { history[$0].sid }.filter { !$0.isEmpty })
+    let removedRows = removedSids.isEmpty ? [] : timeline.remove(sids: removedSids)
+    let insertion = timeline.insert(records(page))
+    return MessageTimelineUpdate(previousCount: previousCount, insertedRows: insertion.insertedRows,
+      removedRows: removedRows, removedSids: removedSids)
+  }
+
+  private func records(range: Range<Int>) -> [MessageRecord] {
+    return range.filter { !unidentifiedResidents.contains($0) }.map { index -> MessageRecord in
+      if history[index].sid.isEmpty {
+        unidentifiedResidents.insert(index)
+      }
+      return history[index]
+    }
+  }
+}
@@ -0,0 +1,16 @@
+//
+//  MessageRecord+TWMMessage.swift
+//  IPMQuickstart
+//
+//  Copyright © 2015 Twilio. All rights reserved.
+//
+
+import Foundation
+
+// Kept apart from MessageTimeline.swift, so the timeline builds without the IP Messaging framework
+extension MessageRecord {
+  init(message: TWMMessage) {
+    self.init(sid: message.sid ?? "", author: message.author ?? "", body: message.body ?? "",
+      timestamp: message.timestamp ?? "")
+  }
+}
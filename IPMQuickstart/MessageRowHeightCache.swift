@@ -0,0 +1,105 @@
+//
+//  MessageRowHeightCache.swift
+//  IPMQuickstart
+//
+//  Copyright © 2015 Twilio. All rights reserved.
+//
+
+import UIKit
+
+/**
+  Row heights for `MessageTableViewCell`, keyed by message `sid` and table width.
+
+  Heights are measured with `NSAttributedString` text metrics rather than by laying out a cell,
+  which is safe off the main thread. `precompute(_:width:)` measures messages on a background
+  queue as they arrive, so by the time their rows are shown the heights are usually cached;
+  a miss is measured synchronously. The cache is only read and written on the main thread.
+
+  Heights are dropped when the table width changes, when their messages leave the history window
+  and on memory warnings, so the cache holds about as many entries as the timeline.
+*/
+final class MessageRowHeightCache {
+  private let measurementQueue = dispatch_queue_create("com.twilio.IPMQuickstart.row-heights", DISPATCH_QUEUE_SERIAL)
+
+  private var width: CGFloat = 0
+  private var heights: [String: CGFloat] = [:]
+
+  /// Height of the row for a message, measuring it now if it is not cached for `width`
+  func height(sid sid: String, body: String, width: CGFloat) -> CGFloat {
+    resetIfNeeded(width)
+    if let height = heights[sid] {
+      return height
+    }
+
+    let height = MessageRowHeightCache.measure(body, width: width, nameFont: MessageTableViewCell.nameFont,
+      bodyFont: MessageTableViewCell.bodyFont)
+    if !sid.isEmpty {
+      heights[sid] = height
+    }
+    return height
+  }
+
+  /// Height cached for a message at the current width, without measuring it
+  func cachedHeight(sid sid: String) -> CGFloat? {
+    return heights[sid]
+  }
+
+  /// Measures messages in the background and caches their heights for `width`
+  func precompute(records: [MessageRecord], width: CGFloat) {
+    resetIfNeeded(width)
+    let pending = records.filter { !$0.sid.isEmpty && self.heights[$0.sid] == nil }
+    if pending.isEmpty {
+      return
+    }
+
+    // Fonts are resolved here, on the main thread, and only their metrics are used in the background
+    let nameFont = MessageTableViewCell.nameFont
+    let bodyFont = MessageTableViewCell.bodyFont
+    dispatch_async(measurementQueue) {
+      let measured = pending.map {
+        ($0.sid, MessageRowHeightCache.measure($0.body, width: width, nameFont: nameFont, bodyFont: bodyFont))
+      }
+
+      dispatch_async(dispatch_get_main_queue()) {
+        // Results for a width the table no longer has are stale
+        if self.width != width {
+          return
+        }
+        for (sid, height) in measured {
+          self.heights[sid] = height
+        }
+      }
+    }
+  }
+
+  /// Drops the heights of messages that left the timeline
+  func remove(sids sids: Set<String>) {
+    for sid in sids {
+      heights.removeValueForKey(sid)
+    }
+  }
+
+  /// Drops every height, as on a memory warning; rows are measured again as they are shown
+  func removeAll() {
+    heights.removeAll()
+  }
+
+  // MARK: Helpers
+
+  private func resetIfNeeded(width: CGFloat) {
+    if self.width != width {
+      self.width = width
+      heights.removeAll()
+    }
+  }
+
+  private static func measure(body: String, width: CGFloat, nameFont: UIFont, bodyFont: UIFont) -> CGFloat {
+    let textWidth = max(width - MessageTableViewCell.horizontalInset * 2, 0)
+    let bodyBounds = (body as NSString).boundingRectWithSize(CGSize(width: textWidth, height: CGFloat.max),
+      options: [.UsesLineFragmentOrigin, .UsesFontLeading], attributes: [NSFontAttributeName: bodyFont],
+      context: nil)
+
+    return MessageTableViewCell.topInset + ceil(nameFont.lineHeight) + MessageTableViewCell.nameBodySpacing +
+      ceil(bodyBounds.height) + MessageTableViewCell.bottomInset
+  }
+}
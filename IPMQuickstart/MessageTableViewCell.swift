@@ -7,20 +7,32 @@
 //
 
 import UIKit
-import SnapKit
 
 class MessageTableViewCell: UITableViewCell {
+  // Layout metrics, shared with MessageRowHeightCache so rows can be measured without a cell
+  static let horizontalInset: CGFloat = 20
+  static let topInset: CGFloat = 10
+  static let bottomInset: CGFloat = 10
+  static let nameBodySpacing: CGFloat = 1
+
+  static var nameFont: UIFont {
+    return UIFont.preferredFontForTextStyle(UIFontTextStyleSubheadline)
+  }
+  
+  static var bodyFont: UIFont {
+    return UIFont.preferredFontForTextStyle(UIFontTextStyleBody)
+  }
 
   lazy var nameLabel: UILabel = {
     let label = UILabel()
-    label.font = UIFont.preferredFontForTextStyle(UIFontTextStyleSubheadline)
+    label.font = MessageTableViewCell.nameFont
     label.textColor = UIColor(red: 0/255.0, green: 128/255.0, blue: 64/255.0, alpha: 1.0)
     return label
   }()
   
   lazy var bodyLabel: UILabel = {
     let label = UILabel()
-    label.font = UIFont.preferredFontForTextStyle(UIFontTextStyleBody)
+    label.font = MessageTableViewCell.bodyFont
     label.numberOfLines = 0
     return label
   }()
@@ -39,19 +51,22 @@ class MessageTableViewCell: UITableViewCell {
   func configureSubviews() {
     self.addSubview(self.nameLabel)
     self.addSubview(self.bodyLabel)
+  }
+  
+  // Frames are computed directly from the same metrics the row height was measured with,
+  // so laying out a row never runs an Auto Layout pass
+  override func layoutSubviews() {
+    super.layoutSubviews()
+    
+    let inset = MessageTableViewCell.horizontalInset
+    let width = max(self.bounds.width - inset * 2, 0)
+    let nameHeight = ceil(self.nameLabel.font.lineHeight)
     
-    nameLabel.snp_makeConstraints { (make) -> Void in
-      make.top.equalTo(self).offset(10)
-      make.left.equalTo(self).offset(20)
-      make.right.equalTo(self).offset(-20)
-    }
+    self.nameLabel.frame = CGRect(x: inset, y: MessageTableViewCell.topInset, width: width, height: nameHeight)
     
-    bodyLabel.snp_makeConstraints { (make) -> Void in
-      make.top.equalTo(nameLabel.snp_bottom).offset(1)
-      make.left.equalTo(self).offset(20)
-      make.right.equalTo(self).offset(-20)
-      make.bottom.equalTo(self).offset(-10)
-    }
+    let bodyTop = self.nameLabel.frame.maxY + MessageTableViewCell.nameBodySpacing
+    let bodyHeight = max(self.bounds.height - bodyTop - MessageTableViewCell.bottomInset, 0)
+    self.bodyLabel.frame = CGRect(x: inset, y: bodyTop, width: width, height: bodyHeight)
   }
 
 
@@ -0,0 +1,260 @@
+//
+//  MessageTimeline.swift
+//  IPMQuickstart
+//
+//  Copyright © 2015 Twilio. All rights reserved.
+//
+
+import Foundation
+
+/// The fields of a message the timeline stores
+struct MessageRecord {
+  let sid: String
+  let author: String
+  let body: String
+  let timestamp: String
+}
+
+/// Rows changed by applying one batch of messages to a timeline
+struct MessageTimelineUpdate {
+  /// Number of messages before the batch was applied
+  let previousCount: Int
+  /// Rows of the inserted messages in the timeline after the batch, ascending
+  let insertedRows: [Int]
+  /// Rows of the removed messages in the timeline before the batch, ascending
+  let removedRows: [Int]
+  /// `sid`s of the removed messages, for dropping what is cached about them
+  let removedSids: Set<String>
+
+  init(previousCount: Int, insertedRows: [Int], removedRows: [Int] = [], removedSids: Set<String> = []) {
+    self.previousCount = previousCount
+    self.insertedRows = insertedRows
+    self.removedRows = removedRows
+    self.removedSids = removedSids
+  }
+
+  var isEmpty: Bool {
+    return insertedRows.isEmpty && removedRows.isEmpty
+  }
+
+  /// Whether every inserted message landed after all the messages that were kept
+  var isAppend: Bool {
+    return insertedRows.first.map { $0 >= previousCount - removedRows.count } ?? true
+  }
+}
+
+/**
+  The messages of a channel, kept ordered by timestamp.
+
+  Messages are stored column-wise: one array per field, with author identities interned so a
+  busy channel keeps a single copy of each name. New messages almost always carry the latest
+  timestamp and are appended in amortized constant time; late arrivals binary-search their
+  row. Messages with equal timestamps keep their insertion order.
+*/
+final class MessageTimeline {
+  private var sids: [String] = []
+  private var timestamps: [String] = []
+  private var bodies: [String] = []
+  private var authorIDs: [UInt32] = []
+
+  // Interned author identities, looked up by `authorIDs`
+  private var authors: [String] = []
+  private var authorIDsByName: [String: UInt32] = [:]
+
+  // Row of every message with a `sid`. Entries for the first `indexedRows` rows are exact; a
+  // late arrival or a removal shifts the rows after it, whose entries are refreshed on lookup.
+  private var rowsBySid: [String: Int] = [:]
+  private var indexedRows = 0
+
+  /// Number of messages (and table rows)
+  var count: Int {
+    return sids.count
+  }
+
+  var isEmpty: Bool {
+    return sids.isEmpty
+  }
+
+  /// Number of distinct authors stored, each once however many messages they wrote
+  var authorCount: Int {
+    return authors.count
+  }
+
+  // MARK: Row Access
+
+  func sid(row: Int) -> String {
+    return sids[row]
+  }
+
+  func author(row: Int) -> String {
+    return authors[Int(authorIDs[row])]
+  }
+
+  func body(row: Int) -> String {
+    return bodies[row]
+  }
+
+  func timestamp(row: Int) -> String {
+    return timestamps[row]
+  }
+
+  func record(row: Int) -> MessageRecord {
+    return MessageRecord(sid: sids[row], author: author(row), body: bodies[row], timestamp: timestamps[row])
+  }
+
+  /// Row of the message with `sid`, in constant time unless rows moved since the last lookup
+  func row(sid sid: String) -> Int? {
+    guard let row = rowsBySid[sid] else {
+      return nil
+    }
+    if row < count && sids[row] == sid {
+      return row
+    }
+
+    for index in indexedRows..<count where !sids[index].isEmpty {
+      rowsBySid[sids[index]] = index
+    }
+    indexedRows = count
+    return rowsBySid[sid]
+  }
+
+  // MARK: Mutation
+
+  /**
+    Inserts a message at the row matching its timestamp.
+
+    - returns: The row the message was inserted at, or `nil` if a message with the same `sid`
+      is already in the timeline. Messages without a `sid` are never treated as duplicates.
+  */
+  func insert(sid sid: String, author: String, body: String, timestamp: String) -> Int? {
+    if !sid.isEmpty && rowsBySid[sid] != nil {
+      return nil
+    }
+
+    let row = insertionRow(timestamp)
+    if !sid.isEmpty {
+      rowsBySid[sid] = row
+    }
+    // Rows before this one keep their entries; rows after it moved down unless it was appended
+    indexedRows = min(indexedRows, row)
+    if indexedRows == row {
+      indexedRows = row + 1
+    }
+    let authorID = intern(author)
+    if row == count {
+      sids.append(sid)
+      timestamps.append(timestamp)
+      bodies.append(body)
+      authorIDs.append(authorID)
+    } else {
+      sids.insert(sid, atIndex: row)
+      timestamps.insert(timestamp, atIndex: row)
+      bodies.insert(body, atIndex: row)
+      authorIDs.insert(authorID, atIndex: row)
+    }
+    return row
+  }
+
+  /**
+    Inserts a batch of messages, such as those received during one display frame.
+
+    - returns: The rows of the inserted messages in the timeline after the whole batch, which is
+      what a single `insertRowsAtIndexPaths` call expects.
+  */
+  func insert(records: [MessageRecord]) -> MessageTimelineUpdate {
+    let previousCount = count
+    var rows: [Int] = []
+    rows.reserveCapacity(records.count)
+
+    for record in records {
+      guard let row = insert(sid: record.sid, author: record.author, body: record.body, timestamp: record.timestamp) else {
+        continue
+      }
+      // Appends never move earlier rows; a late arrival pushes down the rows after it
+      if row < count - 1 {
+        for (index, earlier) in rows.enumerate() where earlier >= row {
+          rows[index] = earlier + 1
+        }
+      }
+      rows.append(row)
+    }
+
+    return MessageTimelineUpdate(previousCount: previousCount, insertedRows: rows.sort())
+  }
+
+  /**
+    Removes every message whose `sid` is in `removed`.
+
+    - returns: The rows the removed messages occupied, ascending.
+  */
+  func remove(sids removed: Set<String>) -> [Int] {
+    var removedRows: [Int] = []
+    var kept = 0
+    for row in 0..<count {
+      if removed.contains(sids[row]) {
+        removedRows.append(row)
+        rowsBySid[sids[row]] = nil
+        continue
+      }
+      if kept != row {
+        sids[kept] = sids[row]
+        timestamps[kept] = timestamps[row]
+        bodies[kept] = bodies[row]
+        authorIDs[kept] = authorIDs[row]
+      }
+      kept += 1
+    }
+
+    let released = kept..<count
+    sids.removeRange(released)
+    timestamps.removeRange(released)
+    bodies.removeRange(released)
+    authorIDs.removeRange(released)
+    if let first = removedRows.first {
+      indexedRows = min(indexedRows, first)
+    }
+    return removedRows
+  }
+
+  func removeAll() {
+    sids.removeAll()
+    timestamps.removeAll()
+    bodies.removeAll()
+    authorIDs.removeAll()
+    authors.removeAll()
+    authorIDsByName.removeAll()
+    rowsBySid.removeAll()
+    indexedRows = 0
+  }
+
+  // MARK: Helpers
+
+  /// Row after the last message whose timestamp is not later than `timestamp`
+  private func insertionRow(timestamp: String) -> Int {
+    if let last = timestamps.last where last <= timestamp {
+      return timestamps.count
+    }
+
+    var low = 0
+    var high = timestamps.count
+    while low < high {
+      let middle = low + (high - low) / 2
+      if timestamps[middle] <= timestamp {
+        low = middle + 1
+      } else {
+        high = middle
+      }
+    }
+    return low
+  }
+
+  private func intern(author: String) -> UInt32 {
+    if let authorID = authorIDsByName[author] {
+      return authorID
+    }
+    let authorID = UInt32(authors.count)
+    authors.append(author)
+    authorIDsByName[author] = authorID
+    return authorID
+  }
+}
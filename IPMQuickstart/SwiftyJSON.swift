@@ -77,6 +77,91 @@ public struct JSON {
         }
     }
 
+    /**
+    Creates a JSON by tokenizing UTF-8 encoded bytes in a single pass into a compact tape, without
+    building an intermediate `NSJSONSerialization` object tree. Containers are read straight from the
+    tape by the subscripts and accessors; Foundation objects are only built if `object` is requested.
+
+    - parameter bytes: The UTF-8 encoded JSON. Any JSON value is accepted at the top level.
+    - parameter error: error The NSErrorPointer used to return the error. `nil` by default.
+
+    - returns: The created JSON
+    */
+    public init(bytes: UnsafeBufferPointer<UInt8>, error: NSErrorPointer = nil) {
+        do {
+            let tape = try JSONTape.parse(bytes)
+            self.init(tape: tape, node: 0)
+        } catch let aError as NSError {
+            if error != nil {
+                error.memory = aError
+            }
+            self.init(NSNull())
+        }
+    }
+
+    /**
+    Creates a JSON by tokenizing a UTF-8 encoded byte array. See `init(bytes:error:)`.
+    */
+    public init(bytes: [UInt8], error: NSErrorPointer = nil) {
+        self = bytes.withUnsafeBufferPointer { JSON(bytes: $0, error: error) }
+    }
+
+    /**
+    Creates a JSON by tokenizing the UTF-8 encoded contents of `data`. See `init(bytes:error:)`.
+    */
+    public init(bytes data: NSData, error: NSErrorPointer = nil) {
+        self.init(bytes: UnsafeBufferPointer(start: UnsafePointer<UInt8>(data.bytes), count: data.length), error: error)
+    }
+
+    /**
+    Creates a lazy JSON view over `data`. The bytes are validated and indexed once, but strings and
+    numbers are left undecoded until they are read through a subscript or accessor, and keys are
+    matched against the raw bytes. Immutable data is retained rather than copied.
+
+    - parameter data:  The UTF-8 encoded JSON. Any JSON value is accepted at the top level.
+    - parameter error: error The NSErrorPointer used to return the error. `nil` by default.
+
+    - returns: The created JSON
+    */
+    public init(lazyData data: NSData, error: NSErrorPointer = nil) {
+        do {
+            let tape = try JSONTape.index(data)
+            self.init(tape: tape, node: 0)
+        } catch let aError as NSError {
+            if error != nil {
+                error.memory = aError
+            }
+            self.init(NSNull())
+        }
+    }
+
+    /// Creates a JSON for a node of a tokenized document
+    private init(tape: JSONTape, node: Int) {
+        switch tape.tags[node] {
+        case .Array:
+            self._type = .Array
+            self.tape = tape
+            self.node = node
+            self.tapeObjects = TapeObjects(tape: tape, node: node)
+        case .Object:
+            self._type = .Dictionary
+            self.tape = tape
+            self.node = node
+            self.tapeObjects = TapeObjects(tape: tape, node: node)
+        case .String, .RawString, .RawEscapedString:
+            self._type = .String
+            self.rawString = tape.string(node)
+        case .Integer, .Double, .RawInteger, .RawDouble:
+            self._type = .Number
+            self.rawNumber = tape.number(node)
+        case .True, .False:
+            self._type = .Bool
+            self.rawNumber = tape.number(node)
+        case .Null:
+            self._type = .Null
+        }
+    }
+
     /**
      Create a JSON from JSON string
     - parameter string: Normal json string like '{"a":"b"}'
@@ -135,15 +220,48 @@ public struct JSON {
     private var _type: Type = .Null
     /// prviate error
     private var _error: NSError? = nil
+    /// Tokenized document backing an array or dictionary created with `init(bytes:)`, and its node
+    private var tape: JSONTape? = nil
+    private var node: Int = 0
+    /// Foundation objects built from the tape, shared by copies of this JSON
+    private var tapeObjects: TapeObjects? = nil
+
+    /// Array elements, built from the tape once when there is one
+    private var arrayObjects: [AnyObject] {
+        return self.tapeObjects?.array ?? self.rawArray
+    }
+
+    /// Dictionary members, built from the tape once when there is one. Indexes into them stay
+    /// valid across calls, which iterating by `startIndex`, `endIndex` and subscript relies on.
+    private var dictionaryObjects: [String : AnyObject] {
+        return self.tapeObjects?.dictionary ?? self.rawDictionary
+    }
+
+    /// Moves a tape-backed container into the raw storage so it can be mutated
+    private mutating func detachTape() {
+        guard self.tape != nil else {
+            return
+        }
+        switch self.type {
+        case .Array:
+            self.rawArray = self.arrayObjects
+        case .Dictionary:
+            self.rawDictionary = self.dictionaryObjects
+        default:
+            break
+        }
+        self.tape = nil
+        self.tapeObjects = nil
+    }
 
     /// Object in JSON
     public var object: AnyObject {
         get {
             switch self.type {
             case .Array:
-                return self.rawArray
+                return self.arrayObjects
             case .Dictionary:
-                return self.rawDictionary
+                return self.dictionaryObjects
             case .String:
                 return self.rawString
             case .Number:
@@ -156,6 +274,8 @@ public struct JSON {
         }
         set {
             _error = nil
+            tape = nil
+            tapeObjects = nil
             switch newValue {
             case let number as NSNumber:
                 if number.isBool {
@@ -194,6 +314,49 @@ public struct JSON {
     public static var null: JSON { get { return JSON(NSNull()) } }
 }
 
+/**
+  The array or dictionary for a container node of a tape, built the first time it is asked for.
+
+  `JSON` is a value type, so the objects live in this shared box rather than in the struct.
+  Building them takes a lock, so that copies read on different threads build them only once.
+*/
+private final class TapeObjects {
+    private let tape: JSONTape
+    private let node: Int
+    private let lock = NSLock()
+    private var builtArray: [AnyObject]?
+    private var builtDictionary: [String : AnyObject]?
+
+    init(tape: JSONTape, node: Int) {
+        self.tape = tape
+        self.node = node
+    }
+
+    var array: [AnyObject] {
+        lock.lock()
+        defer { lock.unlock() }
+
+        if let array = builtArray {
+            return array
+        }
+        let array = tape.arrayObject(node)
+        builtArray = array
+        return array
+    }
+
+    var dictionary: [String : AnyObject] {
+        lock.lock()
+        defer { lock.unlock() }
+
+        if let dictionary = builtDictionary {
+            return dictionary
+        }
+        let dictionary = tape.dictionaryObject(node)
+        builtDictionary = dictionary
+        return dictionary
+    }
+}
+
 // MARK: - CollectionType, SequenceType, Indexable
 extension JSON : Swift.CollectionType, Swift.SequenceType, Swift.Indexable {
 
@@ -204,9 +367,9 @@ extension JSON : Swift.CollectionType, Swift.SequenceType, Swift.Indexable {
     public var startIndex: JSON.Index {
         switch self.type {
         case .Array:
-            return JSONIndex(arrayIndex: self.rawArray.startIndex)
+            return JSONIndex(arrayIndex: 0)
         case .Dictionary:
-            return JSONIndex(dictionaryIndex: self.rawDictionary.startIndex)
+            return JSONIndex(dictionaryIndex: self.dictionaryObjects.startIndex)
         default:
             return JSONIndex()
         }
@@ -215,9 +378,9 @@ extension JSON : Swift.CollectionType, Swift.SequenceType, Swift.Indexable {
     public var endIndex: JSON.Index {
         switch self.type {
         case .Array:
-            return JSONIndex(arrayIndex: self.rawArray.endIndex)
+            return JSONIndex(arrayIndex: self.count)
         case .Dictionary:
-            return JSONIndex(dictionaryIndex: self.rawDictionary.endIndex)
+            return JSONIndex(dictionaryIndex: self.dictionaryObjects.endIndex)
         default:
             return JSONIndex()
         }
@@ -226,9 +389,9 @@ extension JSON : Swift.CollectionType, Swift.SequenceType, Swift.Indexable {
     public subscript (position: JSON.Index) -> JSON.Generator.Element {
         switch self.type {
         case .Array:
-            return (String(position.arrayIndex), JSON(self.rawArray[position.arrayIndex!]))
+            return (String(position.arrayIndex), self[index: position.arrayIndex!])
         case .Dictionary:
-            let (key, value) = self.rawDictionary[position.dictionaryIndex!]
+            let (key, value) = self.dictionaryObjects[position.dictionaryIndex!]
             return (key, JSON(value))
         default:
             return ("", JSON.null)
@@ -239,10 +402,8 @@ extension JSON : Swift.CollectionType, Swift.SequenceType, Swift.Indexable {
     public var isEmpty: Bool {
         get {
             switch self.type {
-            case .Array:
-                return self.rawArray.isEmpty
-            case .Dictionary:
-                return self.rawDictionary.isEmpty
+            case .Array, .Dictionary:
+                return self.count == 0
             default:
                 return true
             }
@@ -251,6 +412,9 @@ extension JSON : Swift.CollectionType, Swift.SequenceType, Swift.Indexable {
 
     /// If `type` is `.Array` or `.Dictionary`, return `array.count` or `dictonary.count` otherwise return `0`.
     public var count: Int {
+        if let tape = self.tape {
+            return tape.count(self.node)
+        }
         switch self.type {
         case .Array:
             return self.rawArray.count
@@ -263,10 +427,8 @@ extension JSON : Swift.CollectionType, Swift.SequenceType, Swift.Indexable {
 
     public func underestimateCount() -> Int {
         switch self.type {
-        case .Array:
-            return self.rawArray.underestimateCount()
-        case .Dictionary:
-            return self.rawDictionary.underestimateCount()
+        case .Array, .Dictionary:
+            return self.count
         default:
             return 0
         }
@@ -386,9 +548,9 @@ public struct JSONGenerator : GeneratorType {
     init(_ json: JSON) {
         self.type = json.type
         if type == .Array {
-            self.arrayGenerate = json.rawArray.generate()
+            self.arrayGenerate = json.arrayObjects.generate()
         }else {
-            self.dictionayGenerate = json.rawDictionary.generate()
+            self.dictionayGenerate = json.dictionaryObjects.generate()
         }
     }
 
@@ -447,7 +609,9 @@ extension JSON {
                 var r = JSON.null
                 r._error = self._error ?? NSError(domain: ErrorDomain, code: ErrorWrongType, userInfo: [NSLocalizedDescriptionKey: "Array[\(index)] failure, It is not an array"])
                 return r
-            } else if index >= 0 && index < self.rawArray.count {
+            } else if let tape = self.tape, element = tape.element(self.node, index: index) {
+                return JSON(tape: tape, node: element)
+            } else if self.tape == nil && index >= 0 && index < self.rawArray.count {
                 return JSON(self.rawArray[index])
             } else {
                 var r = JSON.null
@@ -457,6 +621,7 @@ extension JSON {
         }
         set {
             if self.type == .Array {
+                self.detachTape()
                 if self.rawArray.count > index && newValue.error == nil {
                     self.rawArray[index] = newValue.object
                 }
@@ -469,7 +634,9 @@ extension JSON {
         get {
             var r = JSON.null
             if self.type == .Dictionary {
-                if let o = self.rawDictionary[key] {
+                if let tape = self.tape, value = tape.value(self.node, forKey: key) {
+                    r = JSON(tape: tape, node: value)
+                } else if let o = self.tape == nil ? self.rawDictionary[key] : nil {
                     r = JSON(o)
                 } else {
                     r._error = NSError(domain: ErrorDomain, code: ErrorNotExist, userInfo: [NSLocalizedDescriptionKey: "Dictionary[\"\(key)\"] does not exist"])
@@ -481,6 +648,7 @@ extension JSON {
         }
         set {
             if self.type == .Dictionary && newValue.error == nil {
+                self.detachTape()
                 self.rawDictionary[key] = newValue.object
             }
         }
@@ -517,7 +685,7 @@ extension JSON {
     */
     public subscript(path: [JSONSubscriptType]) -> JSON {
         get {
-            return path.reduce(self) { $0[sub: $1] }
+            return JSONPath(path).evaluate(self)
         }
         set {
             switch path.count {
@@ -555,6 +723,161 @@ extension JSON {
     }
 }
 
+// MARK: - JSONPath
+
+/**
+A path into a JSON document, compiled once and then evaluated against any number of documents.
+
+Evaluation walks the underlying objects (or the tape of a JSON created from bytes) directly, so no
+intermediate JSON is built per hop and an error is only created when the path cannot be followed.
+
+    let authorPath = JSONPath("attributes", "author")
+    let authors = authorPath.evaluateEach(history["messages"]).map { $0.stringValue }
+*/
+public struct JSONPath {
+
+    private let keys: [JSONKey]
+
+    public init(_ path: [JSONSubscriptType]) {
+        self.keys = path.map { $0.jsonKey }
+    }
+
+    public init(_ path: JSONSubscriptType...) {
+        self.init(path)
+    }
+
+    /**
+    Find a json by following the path from `json`.
+
+    - parameter json: The root of the search.
+
+    - returns: Return the json found by the path or a null json with the same error `json[path]` reports
+    */
+    public func evaluate(json: JSON) -> JSON {
+        if self.keys.isEmpty {
+            return json
+        } else if let tape = json.tape {
+            return self.evaluate(tape, node: json.node, inherited: json._error)
+        }
+        return self.evaluate(json.object, inherited: json._error)
+    }
+
+    /**
+    Evaluate the path against every element of `records`, such as one field out of each message of a history dump.
+
+    - parameter records: An array json. Any other type yields an empty array.
+
+    - returns: Return one json per record, each a null json with error where the path could not be followed
+    */
+    public func evaluateEach(records: JSON) -> [JSON] {
+        if let tape = records.tape where records.type == .Array {
+            return tape.elements(records.node).map { self.evaluate(tape, node: $0, inherited: nil) }
+        } else if records.type == .Array {
+            return records.rawArray.map { self.evaluate($0, inherited: nil) }
+        }
+        return []
+    }
+
+    /**
+    Evaluate the path against every json in `records`.
+
+    - parameter records: The roots of the searches.
+
+    - returns: Return one json per record
+    */
+    public func evaluateEach(records: [JSON]) -> [JSON] {
+        return records.map { self.evaluate($0) }
+    }
+
+    private func evaluate(root: AnyObject, inherited: NSError?) -> JSON {
+        var current = root
+        for (hop, key) in self.keys.enumerate() {
+            let error = hop == 0 ? inherited : nil
+            switch key {
+            case .Index(let index):
+                guard let array = current as? NSArray else {
+                    return JSONPath.wrongType(key, inherited: error)
+                }
+                guard index >= 0 && index < array.count else {
+                    return JSONPath.notFound(key)
+                }
+                current = array.objectAtIndex(index)
+            case .Key(let name):
+                guard let dictionary = current as? NSDictionary else {
+                    return JSONPath.wrongType(key, inherited: error)
+                }
+                guard let value = dictionary.objectForKey(name) else {
+                    return JSONPath.notFound(key)
+                }
+                current = value
+            }
+        }
+        return JSON(current)
+    }
+
+    private func evaluate(tape: JSONTape, node root: Int, inherited: NSError?) -> JSON {
+        var node = root
+        for (hop, key) in self.keys.enumerate() {
+            let error = hop == 0 ? inherited : nil
+            switch key {
+            case .Index(let index):
+                guard tape.tags[node] == .Array else {
+                    return JSONPath.wrongType(key, inherited: error)
+                }
+                guard let element = tape.element(node, index: index) else {
+                    return JSONPath.notFound(key)
+                }
+                node = element
+            case .Key(let name):
+                guard tape.tags[node] == .Object else {
+                    return JSONPath.wrongType(key, inherited: error)
+                }
+                guard let value = tape.value(node, forKey: name) else {
+                    return JSONPath.notFound(key)
+                }
+                node = value
+            }
+        }
+        return JSON(tape: tape, node: node)
+    }
+
+    private static func wrongType(key: JSONKey, inherited: NSError?) -> JSON {
+        var r = JSON.null
+        switch key {
+        case .Index(let index):
+            r._error = inherited ?? NSError(domain: ErrorDomain, code: ErrorWrongType, userInfo: [NSLocalizedDescriptionKey: "Array[\(index)] failure, It is not an array"])
+        case .Key(let name):
+            r._error = inherited ?? NSError(domain: ErrorDomain, code: ErrorWrongType, userInfo: [NSLocalizedDescriptionKey: "Dictionary[\"\(name)\"] failure, It is not an dictionary"])
+        }
+        return r
+    }
+
+    private static func notFound(key: JSONKey) -> JSON {
+        var r = JSON.null
+        switch key {
+        case .Index(let index):
+            r._error = NSError(domain: ErrorDomain, code: ErrorIndexOutOfBounds, userInfo: [NSLocalizedDescriptionKey: "Array[\(index)] is out of bounds"])
+        case .Key(let name):
+            r._error = NSError(domain: ErrorDomain, code: ErrorNotExist, userInfo: [NSLocalizedDescriptionKey: "Dictionary[\"\(name)\"] does not exist"])
+        }
+        return r
+    }
+}
+
+extension JSON {
+
+    /**
+    Find a json by evaluating a compiled path. See `JSONPath`.
+
+    - parameter path: The compiled path
+
+    - returns: Return a json found by the path or a null json with error
+    */
+    public subscript(path: JSONPath) -> JSON {
+        return path.evaluate(self)
+    }
+}
+
 // MARK: - LiteralConvertible
 
 extension JSON: Swift.StringLiteralConvertible {
@@ -689,7 +1012,9 @@ extension JSON {
     //Optional [JSON]
     public var array: [JSON]? {
         get {
-            if self.type == .Array {
+            if let tape = self.tape where self.type == .Array {
+                return tape.elements(self.node).map { JSON(tape: tape, node: $0) }
+            } else if self.type == .Array {
                 return self.rawArray.map{ JSON($0) }
             } else {
                 return nil
@@ -709,7 +1034,7 @@ extension JSON {
         get {
             switch self.type {
             case .Array:
-                return self.rawArray
+                return self.arrayObjects
             default:
                 return nil
             }
@@ -730,7 +1055,13 @@ extension JSON {
 
     //Optional [String : JSON]
     public var dictionary: [String : JSON]? {
-        if self.type == .Dictionary {
+        if let tape = self.tape where self.type == .Dictionary {
+            var dictionary = [String : JSON](minimumCapacity: tape.count(self.node))
+            for member in tape.members(self.node) {
+                dictionary[member.key] = JSON(tape: tape, node: member.value)
+            }
+            return dictionary
+        } else if self.type == .Dictionary {
             return self.rawDictionary.reduce([String : JSON]()) { (dictionary: [String : JSON], element: (String, AnyObject)) -> [String : JSON] in
                 var d = dictionary
                 d[element.0] = JSON(element.1)
@@ -751,7 +1082,7 @@ extension JSON {
         get {
             switch self.type {
             case .Dictionary:
-                return self.rawDictionary
+                return self.dictionaryObjects
             default:
                 return nil
             }
@@ -1217,9 +1548,9 @@ public func ==(lhs: JSON, rhs: JSON) -> Bool {
     case (.Bool, .Bool):
         return lhs.rawNumber.boolValue == rhs.rawNumber.boolValue
     case (.Array, .Array):
-        return lhs.rawArray as NSArray == rhs.rawArray as NSArray
+        return lhs.arrayObjects as NSArray == rhs.arrayObjects as NSArray
     case (.Dictionary, .Dictionary):
-        return lhs.rawDictionary as NSDictionary == rhs.rawDictionary as NSDictionary
+        return lhs.dictionaryObjects as NSDictionary == rhs.dictionaryObjects as NSDictionary
     case (.Null, .Null):
         return true
     default:
@@ -1237,9 +1568,9 @@ public func <=(lhs: JSON, rhs: JSON) -> Bool {
     case (.Bool, .Bool):
         return lhs.rawNumber.boolValue == rhs.rawNumber.boolValue
     case (.Array, .Array):
-        return lhs.rawArray as NSArray == rhs.rawArray as NSArray
+        return lhs.arrayObjects as NSArray == rhs.arrayObjects as NSArray
     case (.Dictionary, .Dictionary):
-        return lhs.rawDictionary as NSDictionary == rhs.rawDictionary as NSDictionary
+        return lhs.dictionaryObjects as NSDictionary == rhs.dictionaryObjects as NSDictionary
     case (.Null, .Null):
         return true
     default:
@@ -1257,9 +1588,9 @@ public func >=(lhs: JSON, rhs: JSON) -> Bool {
     case (.Bool, .Bool):
         return lhs.rawNumber.boolValue == rhs.rawNumber.boolValue
     case (.Array, .Array):
-        return lhs.rawArray as NSArray == rhs.rawArray as NSArray
+        return lhs.arrayObjects as NSArray == rhs.arrayObjects as NSArray
     case (.Dictionary, .Dictionary):
-        return lhs.rawDictionary as NSDictionary == rhs.rawDictionary as NSDictionary
+        return lhs.dictionaryObjects as NSDictionary == rhs.dictionaryObjects as NSDictionary
     case (.Null, .Null):
         return true
     default:
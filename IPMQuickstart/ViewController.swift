@@ -17,8 +17,17 @@ class ViewController: SLKTextViewController {
   var generalChannel: TWMChannel? = nil
   // Identity that was assigned to us by the server
   var identity = ""
-  // A list of all the messages displayed in the UI
-  var messages: [TWMMessage] = []
+  // All the messages displayed in the UI, ordered by timestamp
+  let messages = MessageTimeline()
+  // The part of the channel history materialized into `messages`
+  lazy var history: MessageHistoryWindow = MessageHistoryWindow(timeline: self.messages)
+  // Messages received since the last table update; applied together once per frame
+  var pendingMessages: [MessageRecord] = []
+  var tableUpdateScheduled = false
+  // Set while the history window slides, whose contentOffset change re-enters scrollViewDidScroll
+  var slidingHistoryWindow = false
+  // Row heights, measured in the background as messages arrive
+  let rowHeights = MessageRowHeightCache()
   
   // MARK: View Lifecycle
   override func viewDidLoad() {
@@ -32,10 +41,10 @@ class ViewController: SLKTextViewController {
     
     Alamofire.request(.GET, url, parameters: [
       "device": deviceId
-      ]).responseJSON { response in
+      ]).responseData { response in
         if (response.result.isSuccess) {
           // Get token and identity assigned to us from server
-          let json = JSON(response.result.value!)
+          let json = JSON(lazyData: response.result.value!)
           let token = json["token"].stringValue
           
           // Initialize view controller with new IP Messaging client and identity value
@@ -69,13 +78,17 @@ class ViewController: SLKTextViewController {
     }
     
     // Set up UI controls
-    self.tableView.rowHeight = UITableViewAutomaticDimension
     self.tableView.estimatedRowHeight = 66.0
     self.tableView.separatorStyle = .None
     self.tableView.registerClass(MessageTableViewCell.self, forCellReuseIdentifier: "MessageTableViewCell")
     self.inverted = false
   }
   
+  override func didReceiveMemoryWarning() {
+    super.didReceiveMemoryWarning()
+    self.rowHeights.removeAll()
+  }
+  
   // MARK: Setup IP Messaging Channel
   func joinChannel() {
     self.generalChannel?.joinWithCompletion() {
@@ -99,20 +112,90 @@ class ViewController: SLKTextViewController {
   }
   
   func loadMessages() {
-    self.messages.removeAll()
-    let messages = self.generalChannel?.messages.allObjects()
-    self.addMessages(messages!)
+    let messages = (self.generalChannel?.messages.allObjects() ?? []).map { MessageRecord(message: $0) }
+    
+    dispatch_async(dispatch_get_main_queue()) {
+      () -> Void in
+      self.history.reset(messages)
+      self.rowHeights.removeAll()
+      self.rowHeights.precompute((0..<self.messages.count).map { self.messages.record($0) },
+        width: self.tableView.bounds.width)
+      self.tableView.reloadData()
+      self.scrollToBottomMessage()
+    }
   }
   
   func addMessages(messages: [TWMMessage]) {
-    self.messages.appendContentsOf(messages)
-    self.messages.sortInPlace { $1.timestamp > $0.timestamp }
-    
+    let records = messages.map { MessageRecord(message: $0) }
     dispatch_async(dispatch_get_main_queue()) {
       () -> Void in
-      self.tableView.reloadData()
-      if self.messages.count > 0 {
-        self.scrollToBottomMessage()
+      self.pendingMessages.appendContentsOf(records)
+      self.rowHeights.precompute(records, width: self.tableView.bounds.width)
+      self.scheduleTableUpdate()
+    }
+  }
+  
+  // MARK: Table Updates
+  // Apply pending messages at most once per frame, so a burst becomes a single row insertion
+  func scheduleTableUpdate() {
+    if self.tableUpdateScheduled {
+      return
+    }
+    self.tableUpdateScheduled = true
+    
+    let frameDuration = Int64(NSEC_PER_SEC / 60)
+    dispatch_after(dispatch_time(DISPATCH_TIME_NOW, frameDuration), dispatch_get_main_queue()) {
+      () -> Void in
+      self.tableUpdateScheduled = false
+      self.applyPendingMessages()
+    }
+  }
+  
+  func applyPendingMessages() {
+    let update = self.history.appendLive(self.pendingMessages)
+    self.pendingMessages.removeAll()
+    if update.isEmpty {
+      return
+    }
+    
+    self.applyTableUpdate(update)
+    if update.isAppend {
+      self.scrollToBottomMessage()
+    }
+  }
+  
+  func applyTableUpdate(update: MessageTimelineUpdate) {
+    self.rowHeights.remove(sids: update.removedSids)
+    self.tableView.beginUpdates()
+    self.tableView.deleteRowsAtIndexPaths(update.removedRows.map { NSIndexPath(forRow: $0, inSection: 0) },
+      withRowAnimation: .None)
+    self.tableView.insertRowsAtIndexPaths(update.insertedRows.map { NSIndexPath(forRow: $0, inSection: 0) },
+      withRowAnimation: .None)
+    self.tableView.endUpdates()
+  }
+  
+  // Move the history window while keeping the top visible message where it is on screen
+  func slideHistoryWindow(load: () -> MessageTimelineUpdate) {
+    guard let anchorIndexPath = self.tableView.indexPathsForVisibleRows?.first where !self.slidingHistoryWindow else {
+      return
+    }
+    self.slidingHistoryWindow = true
+    defer {
+      self.slidingHistoryWindow = false
+    }
+    let anchorSid = self.messages.sid(anchorIndexPath.row)
+    let anchorOffset = self.tableView.rectForRowAtIndexPath(anchorIndexPath).minY - self.tableView.contentOffset.y
+    
+    let update = load()
+    if update.isEmpty {
+      return
+    }
+    
+    UIView.performWithoutAnimation {
+      self.applyTableUpdate(update)
+      if let row = self.messages.row(sid: anchorSid) {
+        let anchorY = self.tableView.rectForRowAtIndexPath(NSIndexPath(forRow: row, inSection: 0)).minY
+        self.tableView.contentOffset.y = anchorY - anchorOffset
       }
     }
   }
@@ -129,6 +212,23 @@ class ViewController: SLKTextViewController {
       animated: true)
   }
   
+  // MARK: UIScrollView Delegate
+  // Page history in when the user scrolls within a screen of either end of the window
+  override func scrollViewDidScroll(scrollView: UIScrollView!) {
+    super.scrollViewDidScroll(scrollView)
+    if !scrollView.dragging && !scrollView.decelerating {
+      return
+    }
+    
+    let margin = scrollView.bounds.height
+    let distanceToBottom = scrollView.contentSize.height - scrollView.contentOffset.y - scrollView.bounds.height
+    if scrollView.contentOffset.y < margin && self.history.hasOlderMessages {
+      self.slideHistoryWindow { self.history.loadOlderPage() }
+    } else if distanceToBottom < margin && self.history.hasNewerMessages {
+      self.slideHistoryWindow { self.history.loadNewerPage() }
+    }
+  }
+  
   // MARK: UITableView Delegate
   // Return number of rows in the table
   override func tableView(tableView: UITableView, numberOfRowsInSection section: Int) -> Int {
@@ -139,15 +239,19 @@ class ViewController: SLKTextViewController {
   override func tableView(tableView: UITableView, cellForRowAtIndexPath indexPath: NSIndexPath) -> UITableViewCell {
     let cell = tableView.dequeueReusableCellWithIdentifier("MessageTableViewCell", forIndexPath: indexPath) as! MessageTableViewCell
     
-    let message = self.messages[indexPath.row]
-    
-    cell.nameLabel.text = message.author
-    cell.bodyLabel.text = message.body
+    cell.nameLabel.text = self.messages.author(indexPath.row)
+    cell.bodyLabel.text = self.messages.body(indexPath.row)
     cell.selectionStyle = .None
     
     return cell
   }
   
+  // Row heights come from the cache instead of an Auto Layout pass per row
+  func tableView(tableView: UITableView, heightForRowAtIndexPath indexPath: NSIndexPath) -> CGFloat {
+    return self.rowHeights.height(sid: self.messages.sid(indexPath.row), body: self.messages.body(indexPath.row),
+      width: tableView.bounds.width)
+  }
+  
   // MARK: UITableViewDataSource Delegate
   override func numberOfSectionsInTableView(tableView: UITableView) -> Int {
     return 1
@@ -0,0 +1,204 @@
+//
+//  JSONPathTests.swift
+//  IPMQuickstartTests
+//
+//  Copyright © 2015 Twilio. All rights reserved.
+//
+
+import Foundation
+import XCTest
+
+class JSONPathTests: XCTestCase {
+  let document = "{\"messages\": [" +
+    "{\"sid\": \"IM1\", \"attributes\": {\"author\": \"alice\", \"tags\": [\"urgent\", \"pinned\"]}}, " +
+    "{\"sid\": \"IM2\", \"attributes\": {\"author\": \"bob\"}}, " +
+    "{\"sid\": \"IM3\"}, 7], \"count\": 3}"
+
+  var data: NSData {
+    return document.dataUsingEncoding(NSUTF8StringEncoding)!
+  }
+
+  // The same document backed by Foundation objects, an eager tape and a lazy tape
+  var documents: [(backing: String, json: JSON)] {
+    return [("object", JSON(data: data)), ("tape", JSON(bytes: data)), ("lazy tape", JSON(lazyData: data))]
+  }
+
+  // Follows `path` one key at a time, the way `subscript(path:)` resolved paths before `JSONPath`
+  func stepwise(json: JSON, _ path: [JSONSubscriptType]) -> JSON {
+    return path.reduce(json) { current, key in
+      switch key.jsonKey {
+      case .Index(let index): return current[index]
+      case .Key(let name): return current[name]
+      }
+    }
+  }
+
+  // MARK: Evaluate
+
+  func testThatMixedPathsAreFollowed() {
+    for (backing, json) in documents {
+      // When
+      let author = JSONPath("messages", 0, "attributes", "author").evaluate(json)
+      let tag = JSONPath("messages", 0, "attributes", "tags", 1).evaluate(json)
+      let number = JSONPath(["messages", 3]).evaluate(json)
+
+      // Then
+      XCTAssertEqual(author.string, "alice", "\(backing): keys and indexes should be followed")
+      XCTAssertEqual(tag.string, "pinned", "\(backing): index after keys should be followed")
+      XCTAssertEqual(number.int, 7, "\(backing): path built from an array should be followed")
+      XCTAssertNil(author.error, "\(backing): found json should have no error")
+    }
+  }
+
+  func testThatEmptyPathReturnsRoot() {
+    for (backing, json) in documents {
+      // When
+      let root = JSONPath([]).evaluate(json)
+
+      // Then
+      XCTAssertEqual(root, json, "\(backing): empty path should return the root")
+      XCTAssertEqual(root["count"].int, 3, "\(backing): root should stay readable")
+    }
+  }
+
+  func testThatMissingKeysReportNotExist() {
+    for (backing, json) in documents {
+      // When
+      let missingRoot = JSONPath("missing", 0).evaluate(json)
+      let missingLeaf = JSONPath("messages", 2, "attributes", "author").evaluate(json)
+
+      // Then
+      XCTAssertEqual(missingRoot.type, Type.Null, "\(backing): missing key should yield null")
+      XCTAssertEqual(missingRoot.error?.code, ErrorNotExist, "\(backing): missing key should report not exist")
+      XCTAssertEqual(missingLeaf.error?.code, ErrorNotExist, "\(backing): missing nested key should report not exist")
+    }
+  }
+
+  func testThatOutOfRangeIndexesReportOutOfBounds() {
+    for (backing, json) in documents {
+      // When
+      let past = JSONPath("messages", 4, "sid").evaluate(json)
+      let negative = JSONPath("messages", -1).evaluate(json)
+
+      // Then
+      XCTAssertEqual(past.type, Type.Null, "\(backing): index past the end should yield null")
+      XCTAssertEqual(past.error?.code, ErrorIndexOutOfBounds, "\(backing): index past the end should be out of bounds")
+      XCTAssertEqual(negative.error?.code, ErrorIndexOutOfBounds, "\(backing): negative index should be out of bounds")
+    }
+  }
+
+  func testThatWrongTypesReportWrongType() {
+    for (backing, json) in documents {
+      // When
+      let keyIntoArray = JSONPath("messages", "sid").evaluate(json)
+      let indexIntoObject = JSONPath("messages", 0, 0).evaluate(json)
+      let keyIntoNumber = JSONPath("count", "value").evaluate(json)
+
+      // Then
+      XCTAssertEqual(keyIntoArray.error?.code, ErrorWrongType, "\(backing): key into an array should be a wrong type")
+      XCTAssertEqual(indexIntoObject.error?.code, ErrorWrongType, "\(backing): index into an object should be a wrong type")
+      XCTAssertEqual(keyIntoNumber.error?.code, ErrorWrongType, "\(backing): key into a number should be a wrong type")
+    }
+  }
+
+  func testThatErrorOfRootIsInherited() {
+    for (backing, json) in documents {
+      // Given
+      let missing = json["missing"]
+
+      // When
+      let result = JSONPath("author").evaluate(missing)
+
+      // Then
+      XCTAssertEqual(result.error?.code, ErrorNotExist, "\(backing): error of the root should be kept")
+    }
+  }
+
+  // MARK: Parity
+
+  func testThatPathsMatchStepwiseSubscripts() {
+    // Given
+    let paths: [[JSONSubscriptType]] = [
+      [],
+      ["count"],
+      ["messages", 1, "attributes", "author"],
+      ["messages", 0, "attributes", "tags", 0],
+      ["messages", 3],
+      ["missing"],
+      ["missing", 0, "sid"],
+      ["messages", 9, "sid"],
+      ["messages", -1],
+      ["messages", "sid"],
+      ["count", 0],
+      ["messages", 2, "attributes"],
+    ]
+
+    for (backing, json) in documents {
+      for path in paths {
+        // When
+        let compiled = JSONPath(path).evaluate(json)
+        let subscripted = json[path]
+        let expected = stepwise(json, path)
+
+        // Then
+        XCTAssertEqual(compiled, expected, "\(backing): \(path) should find the same json")
+        XCTAssertEqual(compiled.error?.code, expected.error?.code, "\(backing): \(path) should report the same error")
+        XCTAssertEqual(subscripted, compiled, "\(backing): subscript \(path) should evaluate the path")
+        XCTAssertEqual(subscripted.error?.code, compiled.error?.code, "\(backing): subscript \(path) should report the same error")
+      }
+    }
+  }
+
+  func testThatBackingsFindTheSameJSON() {
+    // Given
+    let path = JSONPath("messages", 0, "attributes")
+    let results = documents.map { path.evaluate($0.json) }
+
+    // Then
+    XCTAssertEqual(results[0], results[1], "object and tape backed json should match")
+    XCTAssertEqual(results[0], results[2], "object and lazy tape backed json should match")
+  }
+
+  // MARK: Evaluate Each
+
+  func testThatEvaluateEachFollowsPathInEveryRecord() {
+    for (backing, json) in documents {
+      // When
+      let authors = JSONPath("attributes", "author").evaluateEach(json["messages"])
+
+      // Then
+      XCTAssertEqual(authors.count, 4, "\(backing): every record should yield a json")
+      XCTAssertEqual(authors[0].string, "alice", "\(backing): first author should be found")
+      XCTAssertEqual(authors[1].string, "bob", "\(backing): second author should be found")
+      XCTAssertEqual(authors[2].error?.code, ErrorNotExist, "\(backing): missing attributes should report not exist")
+      XCTAssertEqual(authors[3].error?.code, ErrorWrongType, "\(backing): non-object record should be a wrong type")
+    }
+  }
+
+  func testThatEvaluateEachOfNonArrayIsEmpty() {
+    for (backing, json) in documents {
+      // When
+      let results = JSONPath("sid").evaluateEach(json["count"])
+      let missing = JSONPath("sid").evaluateEach(json["missing"])
+
+      // Then
+      XCTAssertTrue(results.isEmpty, "\(backing): a number should yield no records")
+      XCTAssertTrue(missing.isEmpty, "\(backing): a missing json should yield no records")
+    }
+  }
+
+  func testThatEvaluateEachOfJSONArrayMatchesEvaluate() {
+    for (backing, json) in documents {
+      // Given
+      let records = json["messages"].arrayValue
+      let path = JSONPath("sid")
+
+      // When
+      let sids = path.evaluateEach(records)
+
+      // Then
+      XCTAssertEqual(sids, records.map { path.evaluate($0) }, "\(backing): each json should be evaluated")
+      XCTAssertEqual(sids.prefix(3).map { $0.stringValue }, ["IM1", "IM2", "IM3"], "\(backing): sids should be found")
+    }
+  }
+}
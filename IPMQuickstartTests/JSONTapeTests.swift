@@ -0,0 +1,204 @@
+//
+//  JSONTapeTests.swift
+//  IPMQuickstartTests
+//
+//  Copyright © 2015 Twilio. All rights reserved.
+//
+
+import Foundation
+import XCTest
+
+// JSONTape.swift and SwiftyJSON.swift are compiled into this bundle, so it runs without the app.
+class JSONTapeTests: XCTestCase {
+  func data(string: String) -> NSData {
+    return string.dataUsingEncoding(NSUTF8StringEncoding)!
+  }
+
+  func parse(string: String) throws -> JSONTape {
+    let bytes = [UInt8](string.utf8)
+    return try bytes.withUnsafeBufferPointer { try JSONTape.parse($0) }
+  }
+
+  // MARK: Documents
+
+  func testThatParsedDocumentMatchesFoundation() {
+    // Given
+    let document = "{\"sid\": \"IM1\", \"index\": 42, \"ratio\": 0.5, \"tags\": [true, false, null], " +
+      "\"body\": \"caf\\u00e9 \\ud83d\\ude00\\n\", \"nested\": {\"empty\": [], \"none\": {}}}"
+    let expected = try! NSJSONSerialization.JSONObjectWithData(data(document), options: []) as! NSDictionary
+
+    // When
+    let eager = try! parse(document)
+    let lazy = try! JSONTape.index(data(document))
+
+    // Then
+    XCTAssertEqual(eager.object(0) as? NSDictionary, expected, "eager tape should match NSJSONSerialization")
+    XCTAssertEqual(lazy.object(0) as? NSDictionary, expected, "lazy tape should match NSJSONSerialization")
+  }
+
+  func testThatMalformedDocumentsAreRejected() {
+    let documents = ["{\"a\": }", "[1, 2", "\"unterminated", "01", "[1,]", "{\"a\" 1}", "tru", "1 2"]
+
+    for document in documents {
+      assertThrows(try parse(document), "eager parse should reject \(document)")
+      assertThrows(try JSONTape.index(data(document)), "lazy index should reject \(document)")
+    }
+  }
+
+  func testThatDeeplyNestedDocumentIsRejected() {
+    // Given
+    let depth = JSONTape.maximumDepth + 1
+    let document = String(count: depth, repeatedValue: Character("[")) + String(count: depth, repeatedValue: Character("]"))
+
+    // When, Then
+    assertThrows(try parse(document), "nesting beyond the maximum depth should be rejected")
+  }
+
+  // MARK: Strings
+
+  func testThatLazyIndexRejectsInvalidUTF8() {
+    // Given
+    let invalidSequences: [[UInt8]] = [
+      [0xC0, 0xAF],             // overlong "/"
+      [0xED, 0xA0, 0x80],       // UTF-16 surrogate
+      [0xF4, 0x90, 0x80, 0x80], // above U+10FFFF
+      [0xE2, 0x82],             // truncated
+      [0xFF]
+    ]
+
+    for sequence in invalidSequences {
+      let bytes = [0x5B, 0x22] + sequence + [0x22, 0x5D]
+
+      // When, Then
+      assertThrows(try JSONTape.index(NSData(bytes: bytes, length: bytes.count)), "lazy index should reject \(sequence)")
+    }
+  }
+
+  func testThatLazyIndexRejectsInvalidEscapes() {
+    let documents = ["[\"\\x\"]", "[\"\\u12\"]", "[\"\\ud83d\"]", "[\"\\ude00\"]", "[\"\\ud83d\\u0041\"]"]
+
+    for document in documents {
+      assertThrows(try JSONTape.index(data(document)), "lazy index should reject \(document)")
+    }
+  }
+
+  func testThatKeysMatchByTheirBytes() {
+    // Given
+    let tape = try! JSONTape.index(data("{\"caf\\u00e9\": 1, \"cafe\u{301}\": 2, \"plain\": 3}"))
+
+    // When, Then
+    XCTAssertEqual(tape.value(0, forKey: "caf\u{e9}").map { tape.number($0) }, 1, "escaped precomposed key should match")
+    XCTAssertEqual(tape.value(0, forKey: "cafe\u{301}").map { tape.number($0) }, 2, "raw decomposed key should match")
+    XCTAssertEqual(tape.value(0, forKey: "plain").map { tape.number($0) }, 3, "plain key should match")
+    XCTAssertNil(tape.value(0, forKey: "missing"), "missing key should not match")
+  }
+
+  func testThatLastDuplicateKeyWins() {
+    // Given
+    let document = "{\"sid\": \"IM1\", \"body\": \"first\", \"sid\": \"IM2\"}"
+    let expected = try! NSJSONSerialization.JSONObjectWithData(data(document), options: []) as! NSDictionary
+
+    // When
+    let eager = try! parse(document)
+    let lazy = try! JSONTape.index(data(document))
+
+    // Then
+    XCTAssertEqual(eager.value(0, forKey: "sid").map { eager.string($0) }, "IM2", "eager lookup should return the last value")
+    XCTAssertEqual(lazy.value(0, forKey: "sid").map { lazy.string($0) }, "IM2", "lazy lookup should return the last value")
+    XCTAssertEqual(lazy.value(0, forKey: "sid").map { lazy.string($0) }, expected["sid"] as? String,
+      "lookup should match NSJSONSerialization")
+    XCTAssertEqual(lazy.dictionaryObject(0)["sid"] as? String, "IM2", "dictionary should keep the last value")
+    XCTAssertEqual(JSON(lazyData: data(document))["sid"].string, "IM2", "JSON subscript should return the last value")
+  }
+
+  // MARK: Arrays
+
+  func testThatElementsAreIndexedDirectly() {
+    // Given
+    let document = "[[1, [2, 3]], {\"a\": [4]}, \"five\", [], 6]"
+
+    // When
+    let eager = try! parse(document)
+    let lazy = try! JSONTape.index(data(document))
+
+    // Then
+    for tape in [eager, lazy] {
+      XCTAssertEqual(tape.count(0), 5, "outer array should have five elements")
+      XCTAssertEqual(tape.elements(0), (0..<5).flatMap { tape.element(0, index: $0) }, "elements should match indexed access")
+      XCTAssertEqual(tape.element(0, index: 2).map { tape.string($0) }, "five", "string element should be found")
+      XCTAssertEqual(tape.element(0, index: 4).map { tape.number($0) }, 6, "element after nested containers should be found")
+      XCTAssertEqual(tape.element(0, index: 3).map { tape.count($0) }, 0, "empty array should have no elements")
+
+      let nested = tape.element(0, index: 0).flatMap { tape.element($0, index: 1) }
+      XCTAssertEqual(nested.flatMap { tape.element($0, index: 1) }.map { tape.number($0) }, 3, "nested element should be found")
+      XCTAssertEqual(tape.element(0, index: 1).flatMap { tape.value($0, forKey: "a") }.map { tape.count($0) }, 1,
+        "array inside an object should be indexed")
+      XCTAssertNil(tape.element(0, index: 5), "index past the end should not be found")
+      XCTAssertNil(tape.element(0, index: -1), "negative index should not be found")
+    }
+  }
+
+  // MARK: Numbers
+
+  func testThatLongIntegersStayIntegersUntilTheyOverflow() {
+    // Given
+    let tape = try! parse("[1234567890123456789, 9223372036854775807, -9223372036854775808, 9223372036854775808, -0, 1e2]")
+
+    // When
+    let numbers = tape.elements(0).map { tape.number($0) }
+
+    // Then
+    XCTAssertEqual(numbers[0].longLongValue, 1234567890123456789, "19 digit integer should be exact")
+    XCTAssertEqual(numbers[1].longLongValue, Int64.max, "Int64.max should be exact")
+    XCTAssertEqual(numbers[2].longLongValue, Int64.min, "Int64.min should be exact")
+    XCTAssertEqual(numbers[3].doubleValue, 9223372036854775808.0, "overflowing integer should decode as a double")
+    XCTAssertEqual(String.fromCString(numbers[3].objCType), "d", "overflowing integer should be a double")
+    XCTAssertEqual(numbers[4].longLongValue, 0, "negative zero integer should be zero")
+    XCTAssertEqual(numbers[5].doubleValue, 100, "exponent should decode as a double")
+  }
+
+  // MARK: SwiftyJSON
+
+  func testThatIteratingLazyDictionaryVisitsEveryMember() {
+    // Given
+    let json = JSON(lazyData: data("{\"a\": 1, \"b\": [2, 3], \"c\": {\"d\": 4}}"))
+
+    // When
+    var members: [String: JSON] = [:]
+    var index = json.startIndex
+    while index != json.endIndex {
+      let (key, value) = json[index]
+      members[key] = value
+      index = index.successor()
+    }
+
+    // Then
+    XCTAssertEqual(Array(members.keys).sort(), ["a", "b", "c"], "every member should be visited once")
+    XCTAssertEqual(members["b"]?[1].int, 3, "array member should be readable")
+    XCTAssertEqual(members["c"]?["d"].int, 4, "object member should be readable")
+  }
+
+  func testThatLazyJSONMatchesEagerJSON() {
+    // Given
+    let document = data("{\"messages\": [{\"sid\": \"IM1\", \"body\": \"hi\"}, {\"sid\": \"IM2\", \"body\": \"\\u2603\"}]}")
+
+    // When
+    let eager = JSON(bytes: document)
+    let lazy = JSON(lazyData: document)
+
+    // Then
+    XCTAssertEqual(eager, lazy, "lazy and eager JSON should be equal")
+    XCTAssertEqual(lazy["messages"][1]["body"].string, "\u{2603}", "escaped string should decode")
+    XCTAssertEqual(lazy["messages"].count, 2, "array count should match")
+  }
+}
+
+// MARK: -
+
+/// Asserts that evaluating `expression` throws.
+func assertThrows<T>(@autoclosure expression: () throws -> T, _ message: String, file: String = __FILE__, line: UInt = __LINE__) {
+  do {
+    _ = try expression()
+    XCTFail(message, file: file, line: line)
+  } catch {}
+}
@@ -0,0 +1,153 @@
+//
+//  MessageHistoryWindowTests.swift
+//  IPMQuickstartTests
+//
+//  Copyright © 2015 Twilio. All rights reserved.
+//
+
+import Foundation
+import XCTest
+
+class MessageHistoryWindowTests: XCTestCase {
+  func record(sid: String, second: Int) -> MessageRecord {
+    return MessageRecord(sid: sid, author: "alice", body: "body of \(sid)",
+      timestamp: String(format: "2015-12-08T%06d", second))
+  }
+
+  func history(count: Int) -> [MessageRecord] {
+    return (0..<count).map { record("IM\($0)", second: $0) }
+  }
+
+  func sids(timeline: MessageTimeline) -> [String] {
+    return (0..<timeline.count).map { timeline.sid($0) }
+  }
+
+  // A window of two-message pages holding at most four messages
+  func window() -> MessageHistoryWindow {
+    return MessageHistoryWindow(timeline: MessageTimeline(), pageSize: 2, maximumResidentMessages: 4)
+  }
+
+  // MARK: Reset
+
+  func testThatResetMaterializesNewestPageByTimestamp() {
+    // Given
+    let window = self.window()
+    let unsorted = [3, 5, 0, 4, 1, 2].map { record("IM\($0)", second: $0) }
+
+    // When
+    window.reset(unsorted)
+
+    // Then
+    XCTAssertEqual(sids(window.timeline), ["IM4", "IM5"], "only the newest page should be materialized")
+    XCTAssertTrue(window.hasOlderMessages, "older messages should remain")
+    XCTAssertFalse(window.hasNewerMessages, "no newer messages should remain")
+    XCTAssertTrue(window.isAtLiveEdge, "window should be at the live edge")
+  }
+
+  func testThatResetKeepsChannelOrderForEqualTimestamps() {
+    // Given
+    let window = self.window()
+    let history = [record("IM2", second: 7), record("IM0", second: 1), record("IM3", second: 7),
+      record("IM1", second: 1)]
+
+    // When
+    window.reset(history)
+    window.loadOlderPage()
+
+    // Then
+    XCTAssertEqual(sids(window.timeline), ["IM0", "IM1", "IM2", "IM3"], "equal timestamps should keep channel order")
+  }
+
+  func testThatResetReplacesMaterializedMessages() {
+    // Given
+    let window = self.window()
+    window.reset(history(6))
+
+    // When
+    window.reset([record("IM9", second: 9)])
+
+    // Then
+    XCTAssertEqual(sids(window.timeline), ["IM9"], "previous messages should be removed")
+    XCTAssertFalse(window.hasOlderMessages, "no older messages should remain")
+  }
+
+  // MARK: Sliding
+
+  func testThatLoadingOlderPagesStopsAtOldestMessage() {
+    // Given
+    let window = self.window()
+    window.reset(history(5))
+
+    // When
+    let first = window.loadOlderPage()
+    let second = window.loadOlderPage()
+    let third = window.loadOlderPage()
+
+    // Then
+    XCTAssertEqual(first.insertedRows, [0, 1], "older page should be inserted above the window")
+    XCTAssertTrue(first.removedRows.isEmpty, "nothing should be released below the limit")
+
+    XCTAssertEqual(second.insertedRows, [0], "the partial oldest page should be inserted")
+    XCTAssertEqual(second.removedRows, [3], "the newest message should be released past the limit")
+    XCTAssertEqual(second.removedSids, ["IM4"], "the released sid should be reported")
+    XCTAssertEqual(sids(window.timeline), ["IM0", "IM1", "IM2", "IM3"], "window should hold the oldest messages")
+    XCTAssertFalse(window.hasOlderMessages, "no older messages should remain")
+    XCTAssertTrue(window.hasNewerMessages, "the released message should be newer")
+
+    XCTAssertTrue(third.isEmpty, "loading past the oldest message should change nothing")
+  }
+
+  func testThatLoadingNewerPagesStopsAtNewestMessage() {
+    // Given
+    let window = self.window()
+    window.reset(history(5))
+    window.loadOlderPage()
+    window.loadOlderPage()
+
+    // When
+    let first = window.loadNewerPage()
+    let second = window.loadNewerPage()
+
+    // Then
+    XCTAssertEqual(first.insertedRows, [3], "newer page should be inserted below the window")
+    XCTAssertEqual(first.removedRows, [0], "the oldest message should be released past the limit")
+    XCTAssertEqual(first.removedSids, ["IM0"], "the released sid should be reported")
+    XCTAssertEqual(sids(window.timeline), ["IM1", "IM2", "IM3", "IM4"], "window should hold the newest messages")
+    XCTAssertTrue(window.isAtLiveEdge, "window should be back at the live edge")
+
+    XCTAssertTrue(second.isEmpty, "loading past the newest message should change nothing")
+  }
+
+  // MARK: Live Messages
+
+  func testThatLiveMessagesAreShownAtLiveEdge() {
+    // Given
+    let window = self.window()
+    window.reset(history(3))
+
+    // When
+    let update = window.appendLive([record("IM3", second: 3), record("IM4", second: 4), record("IM5", second: 5)])
+
+    // Then
+    XCTAssertTrue(update.isAppend, "live messages should be appended")
+    XCTAssertEqual(update.removedSids, ["IM1"], "the oldest message should be released past the limit")
+    XCTAssertEqual(sids(window.timeline), ["IM2", "IM3", "IM4", "IM5"], "window should follow live messages")
+  }
+
+  func testThatLiveMessagesWaitAwayFromLiveEdge() {
+    // Given
+    let window = self.window()
+    window.reset(history(5))
+    window.loadOlderPage()
+    window.loadOlderPage()
+
+    // When
+    let update = window.appendLive([record("IM5", second: 5)])
+    window.loadNewerPage()
+
+    // Then
+    XCTAssertTrue(update.isEmpty, "live messages should not be shown away from the live edge")
+    XCTAssertEqual(sids(window.timeline), ["IM2", "IM3", "IM4", "IM5"], "live messages should be paged in later")
+    XCTAssertTrue(window.isAtLiveEdge, "window should be back at the live edge")
+  }
+}
@@ -0,0 +1,127 @@
+//
+//  MessageRowHeightCacheTests.swift
+//  IPMQuickstartTests
+//
+//  Copyright © 2015 Twilio. All rights reserved.
+//
+
+import UIKit
+import XCTest
+
+class MessageRowHeightCacheTests: XCTestCase {
+  let width: CGFloat = 320
+  let shortBody = "hi"
+  let longBody = Array(count: 30, repeatedValue: "a message long enough to wrap").joinWithSeparator(" ")
+
+  func record(sid: String, body: String, second: Int) -> MessageRecord {
+    return MessageRecord(sid: sid, author: "alice", body: body, timestamp: String(format: "2015-12-08T%06d", second))
+  }
+
+  // Measured by a separate cache, so the value never comes from the cache under test
+  func measured(body: String, width: CGFloat) -> CGFloat {
+    return MessageRowHeightCache().height(sid: "", body: body, width: width)
+  }
+
+  func waitForHeights(cache: MessageRowHeightCache, sids: [String]) {
+    let cached = NSPredicate { _, _ in sids.filter { cache.cachedHeight(sid: $0) == nil }.isEmpty }
+    expectationForPredicate(cached, evaluatedWithObject: cache, handler: nil)
+    waitForExpectationsWithTimeout(5, handler: nil)
+  }
+
+  // MARK: Measurement
+
+  func testThatMissIsMeasuredAndCached() {
+    // Given
+    let cache = MessageRowHeightCache()
+
+    // When
+    let long = cache.height(sid: "IM1", body: longBody, width: width)
+    let short = cache.height(sid: "IM2", body: shortBody, width: width)
+    cache.height(sid: "", body: shortBody, width: width)
+
+    // Then
+    XCTAssertGreaterThan(long, short, "a wrapping body should be taller")
+    XCTAssertEqual(cache.cachedHeight(sid: "IM1"), long, "measured height should be cached by sid")
+    XCTAssertEqual(cache.cachedHeight(sid: "IM2"), short, "measured height should be cached by sid")
+    XCTAssertNil(cache.cachedHeight(sid: ""), "a message without a sid should not be cached")
+  }
+
+  func testThatPrecomputeMeasuresInBackground() {
+    // Given
+    let cache = MessageRowHeightCache()
+
+    // When
+    cache.precompute([record("IM1", body: longBody, second: 1), record("IM2", body: shortBody, second: 2)], width: width)
+    waitForHeights(cache, sids: ["IM1", "IM2"])
+
+    // Then
+    XCTAssertEqual(cache.cachedHeight(sid: "IM1"), measured(longBody, width: width), "background height should match a measurement")
+    XCTAssertEqual(cache.cachedHeight(sid: "IM2"), measured(shortBody, width: width), "background height should match a measurement")
+  }
+
+  func testThatPrecomputeForAnOldWidthIsDropped() {
+    // Given
+    let cache = MessageRowHeightCache()
+    cache.precompute([record("IM1", body: longBody, second: 1)], width: width)
+
+    // When
+    cache.precompute([record("IM2", body: longBody, second: 2)], width: width + 55)
+    waitForHeights(cache, sids: ["IM2"])
+
+    // Then
+    XCTAssertNil(cache.cachedHeight(sid: "IM1"), "heights measured for an old width should be dropped")
+    XCTAssertEqual(cache.cachedHeight(sid: "IM2"), measured(longBody, width: width + 55), "height should be for the new width")
+  }
+
+  // MARK: Rows
+
+  func testThatHeightFollowsSidWhenRowsAreInsertedAbove() {
+    // Given
+    let timeline = MessageTimeline()
+    let cache = MessageRowHeightCache()
+    let records = [record("IM2", body: longBody, second: 2), record("IM3", body: shortBody, second: 3)]
+    timeline.insert(records)
+    cache.precompute(records, width: width)
+    waitForHeights(cache, sids: ["IM2", "IM3"])
+
+    // When
+    timeline.insert([record("IM1", body: shortBody, second: 1)])
+
+    // Then, looking rows up the way tableView(_:heightForRowAtIndexPath:) does
+    XCTAssertNil(cache.cachedHeight(sid: timeline.sid(0)), "the inserted message should not have a height yet")
+    XCTAssertEqual(cache.cachedHeight(sid: timeline.sid(1)), measured(longBody, width: width), "moved row should keep its height")
+    XCTAssertEqual(cache.cachedHeight(sid: timeline.sid(2)), measured(shortBody, width: width), "moved row should keep its height")
+    XCTAssertEqual(cache.height(sid: timeline.sid(0), body: timeline.body(0), width: width), measured(shortBody, width: width),
+      "the inserted message should be measured")
+  }
+
+  // MARK: Eviction
+
+  func testThatRemovedSidsAreDropped() {
+    // Given
+    let cache = MessageRowHeightCache()
+    cache.height(sid: "IM1", body: longBody, width: width)
+    cache.height(sid: "IM2", body: shortBody, width: width)
+
+    // When
+    cache.remove(sids: ["IM1"])
+
+    // Then
+    XCTAssertNil(cache.cachedHeight(sid: "IM1"), "removed sid should be dropped")
+    XCTAssertNotNil(cache.cachedHeight(sid: "IM2"), "other sids should be kept")
+  }
+
+  func testThatPurgeFallsBackToMeasurement() {
+    // Given
+    let cache = MessageRowHeightCache()
+    let height = cache.height(sid: "IM1", body: longBody, width: width)
+
+    // When
+    cache.removeAll()
+
+    // Then
+    XCTAssertNil(cache.cachedHeight(sid: "IM1"), "purge should drop every height")
+    XCTAssertEqual(cache.height(sid: "IM1", body: longBody, width: width), height, "height should be measured again after a purge")
+    XCTAssertEqual(cache.cachedHeight(sid: "IM1"), height, "measured height should be cached again")
+  }
+}
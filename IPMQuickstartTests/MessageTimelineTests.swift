@@ -0,0 +1,214 @@
+//
+//  MessageTimelineTests.swift
+//  IPMQuickstartTests
+//
+//  Copyright © 2015 Twilio. All rights reserved.
+//
+
+import Foundation
+import XCTest
+
+// MessageTimeline.swift is compiled into this bundle, so it runs without the app.
+class MessageTimelineTests: XCTestCase {
+  func record(sid: String, author: String = "alice", second: Int) -> MessageRecord {
+    return MessageRecord(sid: sid, author: author, body: "body of \(sid)",
+      timestamp: String(format: "2015-12-08T%06d", second))
+  }
+
+  func sids(timeline: MessageTimeline) -> [String] {
+    return (0..<timeline.count).map { timeline.sid($0) }
+  }
+
+  // MARK: Ordering
+
+  func testThatMessagesAreOrderedByTimestamp() {
+    // Given
+    let timeline = MessageTimeline()
+    timeline.insert([record("IM1", second: 10), record("IM3", second: 30)])
+
+    // When
+    let update = timeline.insert([record("IM4", second: 40), record("IM2", second: 20), record("IM0", second: 0)])
+
+    // Then
+    XCTAssertEqual(sids(timeline), ["IM0", "IM1", "IM2", "IM3", "IM4"], "messages should be ordered by timestamp")
+    XCTAssertEqual(update.previousCount, 2, "previous count should be the count before the batch")
+    XCTAssertEqual(update.insertedRows, [0, 2, 4], "inserted rows should be their rows after the whole batch")
+    XCTAssertFalse(update.isAppend, "a batch with late arrivals should not be an append")
+  }
+
+  func testThatEqualTimestampsKeepInsertionOrder() {
+    // Given
+    let timeline = MessageTimeline()
+
+    // When
+    timeline.insert([record("IM1", second: 5), record("IM2", second: 5)])
+    timeline.insert([record("IM0", second: 1), record("IM3", second: 5)])
+
+    // Then
+    XCTAssertEqual(sids(timeline), ["IM0", "IM1", "IM2", "IM3"], "equal timestamps should keep insertion order")
+  }
+
+  func testThatNewestMessagesAreAnAppend() {
+    // Given
+    let timeline = MessageTimeline()
+    timeline.insert([record("IM1", second: 1)])
+
+    // When
+    let update = timeline.insert([record("IM2", second: 2), record("IM3", second: 3)])
+
+    // Then
+    XCTAssertEqual(update.insertedRows, [1, 2], "inserted rows should follow the existing rows")
+    XCTAssertTrue(update.isAppend, "newest messages should be an append")
+    XCTAssertFalse(update.isEmpty, "update should not be empty")
+  }
+
+  // MARK: Duplicates
+
+  func testThatDuplicateSidsAreInsertedOnce() {
+    // Given
+    let timeline = MessageTimeline()
+    timeline.insert([record("IM1", second: 1)])
+
+    // When
+    let update = timeline.insert([record("IM1", second: 1), record("IM2", second: 2), record("IM2", second: 2)])
+
+    // Then
+    XCTAssertEqual(sids(timeline), ["IM1", "IM2"], "each sid should be inserted once")
+    XCTAssertEqual(update.insertedRows, [1], "only the new message should be reported")
+  }
+
+  func testThatMessagesWithoutSidAreNeverDuplicates() {
+    // Given
+    let timeline = MessageTimeline()
+
+    // When
+    timeline.insert([record("", second: 1), record("", second: 1)])
+
+    // Then
+    XCTAssertEqual(timeline.count, 2, "messages without a sid should all be inserted")
+    XCTAssertNil(timeline.row(sid: ""), "messages without a sid should not be found by sid")
+  }
+
+  func testThatRemovedSidsCanBeInsertedAgain() {
+    // Given
+    let timeline = MessageTimeline()
+    timeline.insert([record("IM1", second: 1), record("IM2", second: 2), record("IM3", second: 3)])
+
+    // When
+    let removedRows = timeline.remove(sids: ["IM1", "IM3"])
+    let update = timeline.insert([record("IM3", second: 3)])
+
+    // Then
+    XCTAssertEqual(removedRows, [0, 2], "removed rows should be their rows before the removal")
+    XCTAssertEqual(update.insertedRows, [1], "a removed message should be inserted again")
+    XCTAssertEqual(sids(timeline), ["IM2", "IM3"], "timeline should hold the remaining and reinserted messages")
+  }
+
+  // MARK: Row Lookup
+
+  func testThatRowsAreFoundBySid() {
+    // Given
+    let timeline = MessageTimeline()
+
+    // When
+    timeline.insert((0..<10).map { record("IM\($0)", second: $0) })
+
+    // Then
+    for row in 0..<10 {
+      XCTAssertEqual(timeline.row(sid: "IM\(row)"), row, "appended message should be found at its row")
+    }
+    XCTAssertNil(timeline.row(sid: "IM10"), "unknown sid should not be found")
+  }
+
+  func testThatRowsAreFoundAfterLateArrivals() {
+    // Given
+    let timeline = MessageTimeline()
+    timeline.insert([record("IM2", second: 2), record("IM4", second: 4)])
+    XCTAssertEqual(timeline.row(sid: "IM4"), 1, "message should be found before the late arrivals")
+
+    // When
+    timeline.insert([record("IM3", second: 3), record("IM5", second: 5), record("IM1", second: 1)])
+
+    // Then
+    XCTAssertEqual(sids(timeline).map { timeline.row(sid: $0) ?? -1 }, [0, 1, 2, 3, 4],
+      "every message should be found at its row after late arrivals")
+  }
+
+  func testThatRowsAreFoundAfterRemoval() {
+    // Given
+    let timeline = MessageTimeline()
+    timeline.insert((0..<6).map { record("IM\($0)", second: $0) })
+
+    // When
+    timeline.remove(sids: ["IM0", "IM3"])
+    timeline.insert([record("IM6", second: 6)])
+
+    // Then
+    XCTAssertNil(timeline.row(sid: "IM0"), "removed message should not be found")
+    XCTAssertNil(timeline.row(sid: "IM3"), "removed message should not be found")
+    XCTAssertEqual(sids(timeline).map { timeline.row(sid: $0) ?? -1 }, [0, 1, 2, 3, 4],
+      "remaining messages should be found at their rows")
+  }
+
+  func testThatRowsAreNotFoundAfterRemoveAll() {
+    // Given
+    let timeline = MessageTimeline()
+    timeline.insert([record("IM1", second: 1), record("IM2", second: 2)])
+
+    // When
+    timeline.removeAll()
+    timeline.insert([record("IM2", second: 2)])
+
+    // Then
+    XCTAssertNil(timeline.row(sid: "IM1"), "message removed with all others should not be found")
+    XCTAssertEqual(timeline.row(sid: "IM2"), 0, "reinserted message should be found at its new row")
+  }
+
+  // MARK: Authors
+
+  func testThatAuthorsAreInterned() {
+    // Given
+    let timeline = MessageTimeline()
+
+    // When
+    timeline.insert((0..<100).map { record("IM\($0)", author: $0 % 2 == 0 ? "alice" : "bob", second: $0) })
+
+    // Then
+    XCTAssertEqual(timeline.authorCount, 2, "each author should be stored once")
+    XCTAssertEqual(timeline.author(0), "alice", "first author should be alice")
+    XCTAssertEqual(timeline.author(99), "bob", "last author should be bob")
+    XCTAssertEqual(timeline.record(42).body, "body of IM42", "record should read every column of its row")
+  }
+
+  // MARK: Benchmarks
+
+  func testPerformanceOfRowLookup() {
+    let timeline = MessageTimeline()
+    timeline.insert((0..<20_000).map { record("IM\($0)", second: $0) })
+
+    measureBlock {
+      for number in 0.stride(to: 20_000, by: 7) {
+        XCTAssertEqual(timeline.row(sid: "IM\(number)"), number, "message should be found at its row")
+      }
+    }
+  }
+
+  func testPerformanceOfBulkInsert() {
+    let batches = (0..<200).map { batch in
+      (0..<100).map { index -> MessageRecord in
+        let number = batch * 100 + index
+        // One message in ten arrives late, a few seconds behind the rest of its batch
+        let second = index % 10 == 0 ? max(number - 5, 0) : number
+        return self.record("IM\(number)", author: "author\(number % 50)", second: second)
+      }
+    }
+
+    measureBlock {
+      let timeline = MessageTimeline()
+      for batch in batches {
+        timeline.insert(batch)
+      }
+      XCTAssertEqual(timeline.count, 20_000, "every message should be inserted")
+    }
+  }
+}